@@ -2,9 +2,14 @@
 
 #include "AnimNode_Tether.h"
 
+#include "TetherBodyColliders.h"
 #include "TetherSettings.h"
+#include "TetherSimulation.h"
 #include "TetherStatics.h"
+#include "TetherWorldSubsystem.h"
+#include "Animation/AnimInstance.h"
 #include "Animation/AnimInstanceProxy.h"
+#include "Components/SkeletalMeshComponent.h"
 
 DECLARE_CYCLE_STAT(TEXT("Tether_Update"), STAT_TetherUpdate, STATGROUP_Tether);
 DECLARE_CYCLE_STAT(TEXT("Tether_Evaluate"), STAT_TetherEval, STATGROUP_Tether);
@@ -13,11 +18,102 @@ DECLARE_CYCLE_STAT(TEXT("Tether_Evaluate"), STAT_TetherEval, STATGROUP_Tether);
 // TAutoConsoleVariable<bool> CVarTetherDebug(TEXT("p.Tether.Debug"), false, TEXT("Draw Tether Debugging information"));
 // #endif
 
+void FAnimNode_Tether::OnInitializeAnimInstance(const FAnimInstanceProxy* InProxy, const UAnimInstance* InAnimInstance)
+{
+	Super::OnInitializeAnimInstance(InProxy, InAnimInstance);
+
+	// Import on the game thread, the physics asset can't be read from the anim thread
+	BodyColliders.Reset();
+	if (bImportBodyColliders)
+	{
+		const USkeletalMeshComponent* MeshComponent = InAnimInstance->GetSkelMeshComponent();
+		const UPhysicsAsset* PhysicsAsset = BodyColliderAsset ? BodyColliderAsset.Get() :
+			MeshComponent ? MeshComponent->GetPhysicsAsset() : nullptr;
+
+		BodyColliders = MakeShared<FTetherBodyColliders, ESPMode::ThreadSafe>();
+		BodyColliders->Import(PhysicsAsset);
+	}
+}
+
 void FAnimNode_Tether::Initialize_AnyThread(const FAnimationInitializeContext& Context)
 {
 	Super::Initialize_AnyThread(Context);
 
-	PhysicsUpdate = { SimulationFrameRate };
+	// Settings may have changed, rebuild the simulation on the next update
+	UnregisterSimulation();
+}
+
+void FAnimNode_Tether::BuildSimulation()
+{
+	Simulation = MakeShared<FTetherSimulation, ESPMode::ThreadSafe>(SimulationFrameRate, MaxSubsteps, SubstepOverflow);
+	Simulation->SharedData.SpatialHashingInput = SpatialHashingInput;
+	Simulation->SharedData.Solvers.UpdateSolverData(HashingSystem, CollisionDetectionHandler,
+		BroadPhaseCollisionDetection, NarrowPhaseCollisionDetection);
+
+	// The simulation gets its own copy of the colliders, the imported ones are never touched by it
+	if (BodyColliders.IsValid() && !BodyColliders->IsEmpty())
+	{
+		BodyColliders->AddToSimulation(*Simulation);
+	}
+
+	SimulatedBoneShapes.SetNumUninitialized(SimulatedBones.Num());
+	for (int32 i = 0; i < SimulatedBones.Num(); i++)
+	{
+		const FTetherSimulatedBone& SimulatedBone = SimulatedBones[i];
+
+		FTetherCommonShapeData Data;
+		Data.LinearInput.Settings = SimulatedBone.LinearSettings;
+
+		const int32 ShapeIndex = Simulation->AddShapeCopy(
+			FTetherShape_BoundingSphere(FVector::ZeroVector, SimulatedBone.Radius), Data);
+		SimulatedBoneShapes[i] = ShapeIndex;
+
+		// Critical damping is 2 * sqrt(Stiffness) for a spring with unit mass
+		const float Damping = 2.f * SimulatedBone.DampingRatio * FMath::Sqrt(SimulatedBone.Stiffness);
+		Simulation->SetDrive(ShapeIndex, SimulatedBone.Stiffness, Damping);
+
+		// The sphere sits inside its own bone's colliders, they would always be in contact
+		if (BodyColliders.IsValid())
+		{
+			for (int32 Collider = 0; Collider < BodyColliders->Num(); Collider++)
+			{
+				if (BodyColliders->GetBone(Collider).BoneName == SimulatedBone.Bone.BoneName)
+				{
+					const TArray<FTetherShape*>& Shapes = Simulation->GetShapes();
+					Simulation->IgnoreCollision(Shapes[ShapeIndex], Shapes[BodyColliders->GetSimulationIndex(Collider)]);
+				}
+			}
+		}
+	}
+
+	bTeleportSimulatedBones = true;
+}
+
+void FAnimNode_Tether::RegisterSimulation(const UWorld* World)
+{
+	UTetherWorldSubsystem* Subsystem = UTetherWorldSubsystem::Get(World);
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	BuildSimulation();
+	Subsystem->RegisterSimulation(Simulation.ToSharedRef());
+	bSimulationRegistered = true;
+}
+
+void FAnimNode_Tether::UnregisterSimulation()
+{
+	// The simulation owns its shapes, the subsystem can keep ticking it until it drops it without touching ours
+	if (Simulation.IsValid())
+	{
+		if (bSimulationRegistered)
+		{
+			Simulation->Unregister();
+		}
+		Simulation.Reset();
+	}
+	bSimulationRegistered = false;
 }
 
 void FAnimNode_Tether::UpdateInternal(const FAnimationUpdateContext& Context)
@@ -32,6 +128,24 @@ void FAnimNode_Tether::UpdateInternal(const FAnimationUpdateContext& Context)
 	{
 		return;
 	}
+
+	// Switching between batched and local simulation rebuilds the simulation
+	if (Simulation.IsValid() && bSimulationRegistered != bBatchSimulation)
+	{
+		UnregisterSimulation();
+	}
+
+	if (!Simulation.IsValid())
+	{
+		if (bBatchSimulation)
+		{
+			RegisterSimulation(Owner->GetWorld());
+		}
+		else
+		{
+			BuildSimulation();
+		}
+	}
 }
 
 void FAnimNode_Tether::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output,
@@ -59,16 +173,84 @@ void FAnimNode_Tether::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseCont
 	// This initializes the bone so that it can be modified; it is not merely grabbing a transform
 	FTransform RootTM = Output.Pose.GetComponentSpaceTransform(RootBoneIndex);
 
-	// Start the frame with the current DeltaTime
-	PhysicsUpdate.StartFrame(Output.AnimInstanceProxy->GetDeltaSeconds());
+	// Built by the first update
+	if (!Simulation.IsValid())
+	{
+		return;
+	}
+
+	const FTransform& ComponentTransform = Output.AnimInstanceProxy->GetComponentTransform();
+
+	// Move the body colliders to the current pose and pull the simulated bones towards it
+	if (BodyColliders.IsValid())
+	{
+		BodyColliders->UpdateFromPose(Output.Pose, ComponentTransform, *Simulation);
+	}
+	DriveSimulatedBones(Output.Pose, ComponentTransform);
+
+	// Update at consistent framerate (default 60fps), unless the world subsystem simulates on our behalf
+	if (!bSimulationRegistered)
+	{
+		Simulation->Tick(Output.AnimInstanceProxy->GetDeltaSeconds());
+	}
 
-	// Update at consistent framerate (default 60fps)
-	while (PhysicsUpdate.ShouldTick())
+	if (const FTetherPhysicsOutput* SimulationOutput = Simulation->ReadLatestOutput())
 	{
-		PhysicsUpdate.FinalizeTick();
+		ApplySimulatedBones(Output.Pose, ComponentTransform, *SimulationOutput, OutBoneTransforms);
 	}
 }
 
+void FAnimNode_Tether::DriveSimulatedBones(FCSPose<FCompactPose>& Pose, const FTransform& ComponentTransform)
+{
+	for (int32 i = 0; i < SimulatedBoneShapes.Num(); i++)
+	{
+		const FCompactPoseBoneIndex BoneIndex = SimulatedBoneIndices.IsValidIndex(i) ?
+			SimulatedBoneIndices[i] : FCompactPoseBoneIndex(INDEX_NONE);
+		if (!BoneIndex.IsValid())
+		{
+			continue;
+		}
+
+		const FTransform BoneTransform = Pose.GetComponentSpaceTransform(BoneIndex) * ComponentTransform;
+
+		FTetherPhysicsInput Input(SimulatedBoneShapes[i]);
+		Input.DriveTarget = BoneTransform.GetLocation();
+		if (bTeleportSimulatedBones)
+		{
+			Input.KinematicTransform = BoneTransform;
+		}
+		Simulation->EnqueueInput(MoveTemp(Input));
+	}
+
+	bTeleportSimulatedBones = false;
+}
+
+void FAnimNode_Tether::ApplySimulatedBones(FCSPose<FCompactPose>& Pose, const FTransform& ComponentTransform,
+	const FTetherPhysicsOutput& SimulationOutput, TArray<FBoneTransform>& OutBoneTransforms) const
+{
+	for (int32 i = 0; i < SimulatedBoneShapes.Num(); i++)
+	{
+		const FCompactPoseBoneIndex BoneIndex = SimulatedBoneIndices.IsValidIndex(i) ?
+			SimulatedBoneIndices[i] : FCompactPoseBoneIndex(INDEX_NONE);
+		const int32 ShapeIndex = SimulatedBoneShapes[i];
+		if (!BoneIndex.IsValid() || !SimulationOutput.ShapeTransforms.IsValidIndex(ShapeIndex))
+		{
+			continue;
+		}
+
+		// Blend between the last two sub-ticks, the frame rarely lands exactly on one
+		const FVector Location = SimulationOutput.GetInterpolatedTransform(ShapeIndex).GetLocation();
+
+		// Keep the animated rotation and scale, only the location is simulated
+		FTransform BoneTransform = Pose.GetComponentSpaceTransform(BoneIndex);
+		BoneTransform.SetLocation(ComponentTransform.InverseTransformPosition(Location));
+		OutBoneTransforms.Emplace(BoneIndex, BoneTransform);
+	}
+
+	// The skeletal control base requires the transforms in bone order
+	OutBoneTransforms.Sort(FCompareBoneTransformIndex());
+}
+
 bool FAnimNode_Tether::IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones)
 {
 	if (!RootBone.IsValidToEvaluate(RequiredBones))
@@ -82,4 +264,16 @@ void FAnimNode_Tether::InitializeBoneReferences(const FBoneContainer& RequiredBo
 {
 	RootBone.Initialize(RequiredBones);
 	RootBoneIndex = RootBone.GetCompactPoseIndex(RequiredBones);
+
+	if (BodyColliders.IsValid())
+	{
+		BodyColliders->InitializeBoneReferences(RequiredBones);
+	}
+
+	SimulatedBoneIndices.Reset(SimulatedBones.Num());
+	for (FTetherSimulatedBone& SimulatedBone : SimulatedBones)
+	{
+		SimulatedBone.Bone.Initialize(RequiredBones);
+		SimulatedBoneIndices.Add(SimulatedBone.Bone.GetCompactPoseIndex(RequiredBones));
+	}
 }
@@ -0,0 +1,157 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "TetherBodyColliders.h"
+
+#include "TetherSimulation.h"
+#include "TetherStatics.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+
+DECLARE_CYCLE_STAT(TEXT("Tether_BodyColliders_Update"), STAT_TetherBodyCollidersUpdate, STATGROUP_Tether);
+
+namespace FTether
+{
+	static bool HasCollision(const FKShapeElem& Elem)
+	{
+		return Elem.GetCollisionEnabled() != ECollisionEnabled::NoCollision;
+	}
+}
+
+void FTetherBodyColliders::Import(const UPhysicsAsset* PhysicsAsset)
+{
+	Reset();
+
+	if (!PhysicsAsset)
+	{
+		return;
+	}
+
+	// Gather each type separately, colliders are indexed by type
+	TArray<FName> SphereBones;
+	TArray<FName> CapsuleBones;
+	TArray<FName> BoxBones;
+
+	for (const USkeletalBodySetup* BodySetup : PhysicsAsset->SkeletalBodySetups)
+	{
+		if (!BodySetup)
+		{
+			continue;
+		}
+
+		const FName BoneName = BodySetup->BoneName;
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+
+		for (const FKSphereElem& Elem : AggGeom.SphereElems)
+		{
+			if (FTether::HasCollision(Elem))
+			{
+				Spheres.Emplace(Elem.Center, Elem.Radius);
+				SphereBones.Add(BoneName);
+			}
+		}
+
+		for (const FKSphylElem& Elem : AggGeom.SphylElems)
+		{
+			if (FTether::HasCollision(Elem))
+			{
+				// Sphyl length is the cylinder only, our half height includes the hemispheres
+				Capsules.Emplace(Elem.Center, Elem.Length * 0.5f + Elem.Radius, Elem.Radius, Elem.Rotation);
+				CapsuleBones.Add(BoneName);
+			}
+		}
+
+		for (const FKBoxElem& Elem : AggGeom.BoxElems)
+		{
+			if (FTether::HasCollision(Elem))
+			{
+				Boxes.Emplace(Elem.Center, FVector(Elem.X, Elem.Y, Elem.Z) * 0.5, Elem.Rotation);
+				BoxBones.Add(BoneName);
+			}
+		}
+	}
+
+	for (const TArray<FName>* TypeBones : { &SphereBones, &CapsuleBones, &BoxBones })
+	{
+		for (const FName& BoneName : *TypeBones)
+		{
+			Bones.Emplace(BoneName);
+		}
+	}
+
+	// Resolve collision filters once here, each simulation's copies inherit them
+	for (int32 i = 0; i < Num(); i++)
+	{
+		GetShape(i)->SimulationMode = ETetherSimulationMode::Kinematic;
+		GetShape(i)->ResolveCollisionFilter();
+	}
+
+	ShapeData.SetNum(Num());
+	BoneIndices.Init(FCompactPoseBoneIndex(INDEX_NONE), Num());
+}
+
+void FTetherBodyColliders::Reset()
+{
+	Spheres.Reset();
+	Capsules.Reset();
+	Boxes.Reset();
+	ShapeData.Reset();
+	Bones.Reset();
+	BoneIndices.Reset();
+	SimulationIndices.Reset();
+}
+
+void FTetherBodyColliders::InitializeBoneReferences(const FBoneContainer& RequiredBones)
+{
+	for (int32 i = 0; i < Num(); i++)
+	{
+		Bones[i].Initialize(RequiredBones);
+		BoneIndices[i] = Bones[i].GetCompactPoseIndex(RequiredBones);
+	}
+}
+
+void FTetherBodyColliders::AddToSimulation(FTetherSimulation& Simulation)
+{
+	SimulationIndices.SetNumUninitialized(Num());
+	for (int32 i = 0; i < Num(); i++)
+	{
+		SimulationIndices[i] = Simulation.AddShapeCopy(*GetShape(i), ShapeData[i]);
+	}
+}
+
+void FTetherBodyColliders::UpdateFromPose(FCSPose<FCompactPose>& Pose, const FTransform& ComponentTransform,
+	FTetherSimulation& Simulation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TetherBodyCollidersUpdate);
+
+	for (int32 i = 0; i < Num(); i++)
+	{
+		const FCompactPoseBoneIndex BoneIndex = BoneIndices[i];
+		if (!BoneIndex.IsValid())
+		{
+			continue;
+		}
+
+		// The simulation owns its copy of the shape, it applies this before its next sub-tick
+		FTetherPhysicsInput Input(GetSimulationIndex(i));
+		Input.KinematicTransform = Pose.GetComponentSpaceTransform(BoneIndex) * ComponentTransform;
+		Simulation.EnqueueInput(MoveTemp(Input));
+	}
+}
+
+FTetherShape* FTetherBodyColliders::GetShape(int32 Index)
+{
+	if (Spheres.IsValidIndex(Index))
+	{
+		return &Spheres[Index];
+	}
+	Index -= Spheres.Num();
+
+	if (Capsules.IsValidIndex(Index))
+	{
+		return &Capsules[Index];
+	}
+	Index -= Capsules.Num();
+
+	return Boxes.IsValidIndex(Index) ? &Boxes[Index] : nullptr;
+}
@@ -0,0 +1,172 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "TetherSimulation.h"
+
+#include "Threading/TetherPhysicsPipeline.h"
+
+FTetherSimulation::FTetherSimulation(float SimulationFrameRate, int32 MaxSubsteps, ETetherSubstepOverflow OverflowPolicy)
+	: PhysicsUpdate(SimulationFrameRate, MaxSubsteps, OverflowPolicy)
+	, bPendingRemoval(false)
+{}
+
+int32 FTetherSimulation::AddShape(FTetherShape* Shape, FTetherCommonShapeData* Data)
+{
+	// The index is used to look up solver outputs
+	Shape->SimulationIndex = Shapes.Add(Shape);
+
+	// Resolve collision groups from the shape's tags once, rather than comparing tags for every pair
+	if (!Shape->IsCollisionFilterResolved())
+	{
+		Shape->ResolveCollisionFilter();
+	}
+
+	Data->InitializeShapeData();
+	Data->Solvers.UpdateSolvers();
+
+	// Add to the body store, in SimulationIndex order
+	SharedData.Bodies.Add(Shape, Data);
+	Drives.AddDefaulted();
+
+	return Shape->SimulationIndex;
+}
+
+int32 FTetherSimulation::AddShapeCopy(const FTetherShape& Shape, const FTetherCommonShapeData& Data)
+{
+	FTetherShape* ShapeCopy = OwnedShapes.Add_GetRef(Shape.Clone()).Get();
+	FTetherCommonShapeData* DataCopy = OwnedShapeData.Add_GetRef(MakeUnique<FTetherCommonShapeData>(Data)).Get();
+	return AddShape(ShapeCopy, DataCopy);
+}
+
+void FTetherSimulation::SetDrive(int32 ShapeIndex, float Stiffness, float Damping)
+{
+	if (Drives.IsValidIndex(ShapeIndex))
+	{
+		Drives[ShapeIndex].Stiffness = Stiffness;
+		Drives[ShapeIndex].Damping = Damping;
+
+		// Sleeping would leave the shape behind its target
+		Shapes[ShapeIndex]->ActivityState = ETetherActivityState::ForceAwake;
+	}
+}
+
+void FTetherSimulation::RefreshCollisionFilters()
+{
+	for (FTetherShape* Shape : Shapes)
+	{
+		if (!Shape->IsCollisionFilterResolved())
+		{
+			Shape->ResolveCollisionFilter();
+		}
+	}
+}
+
+const FTetherPhysicsOutput* FTetherSimulation::ReadLatestOutput()
+{
+	Outputs.Update();
+	return Outputs.HasReadBuffer() ? &Outputs.GetReadBuffer() : nullptr;
+}
+
+void FTetherSimulation::Tick(float DeltaTime, ETetherPhysicsUpdateMode Mode)
+{
+	// Same steps as UTetherWorldSubsystem, for a single simulation
+	SharedData.InitializeSharedData();
+	RefreshCollisionFilters();
+
+	PhysicsUpdate.StartFrame(DeltaTime);
+	while (PhysicsUpdate.ShouldTick())
+	{
+		ApplyInputs();
+		CapturePreviousTransforms();
+
+		FTetherPhysicsPipeline::Tick(Mode, Shapes, SharedData, Origin, PhysicsUpdate.StepTime,
+			PhysicsUpdate.GetSimulatedTime());
+
+		PhysicsUpdate.FinalizeTick();
+	}
+
+	if (PhysicsUpdate.SubstepsThisFrame > 0)
+	{
+		PublishOutput();
+	}
+}
+
+void FTetherSimulation::ApplyInputs()
+{
+	FTetherPhysicsInput Input;
+	while (Inputs.Dequeue(Input))
+	{
+		if (!Shapes.IsValidIndex(Input.ShapeIndex))
+		{
+			continue;
+		}
+
+		FTetherShape* Shape = Shapes[Input.ShapeIndex];
+		FTetherCommonShapeData* Data = SharedData.Bodies.ShapeData[Input.ShapeIndex];
+
+		if (Input.KinematicTransform.IsSet())
+		{
+			Shape->ToWorldSpace(Input.KinematicTransform.GetValue());
+
+			// A simulated shape was teleported, don't carry its velocity across the jump
+			if (Shape->SimulationMode != ETetherSimulationMode::Kinematic)
+			{
+				Data->LinearOutput.LinearVelocity = FVector::ZeroVector;
+				Data->AngularOutput.AngularVelocity = FVector::ZeroVector;
+			}
+		}
+
+		if (Input.DriveTarget.IsSet())
+		{
+			Drives[Input.ShapeIndex].Target = Input.DriveTarget;
+		}
+
+		Drives[Input.ShapeIndex].Force = Input.Force;
+		Data->LinearInput.Settings.Force = Input.Force;
+		Data->AngularInput.Settings.Torque = Input.Torque;
+	}
+
+	// Springs depend on the current state, so they are evaluated every sub-tick even without new inputs
+	for (int32 i = 0; i < Drives.Num(); i++)
+	{
+		const FDrive& Drive = Drives[i];
+		if (Drive.Stiffness <= 0.f || !Drive.Target.IsSet())
+		{
+			continue;
+		}
+
+		FTetherCommonShapeData* Data = SharedData.Bodies.ShapeData[i];
+		const FVector Offset = Drive.Target.GetValue() - Shapes[i]->GetAppliedWorldTransform().GetLocation();
+		const FVector Acceleration = Offset * Drive.Stiffness - Data->LinearOutput.LinearVelocity * Drive.Damping;
+		Data->LinearInput.Settings.Force = Drive.Force + Acceleration * Data->LinearInput.Settings.Mass;
+	}
+}
+
+void FTetherSimulation::CapturePreviousTransforms()
+{
+	PreviousShapeTransforms.SetNumUninitialized(Shapes.Num());
+	for (int32 i = 0; i < Shapes.Num(); i++)
+	{
+		PreviousShapeTransforms[i] = Shapes[i]->GetAppliedWorldTransform();
+	}
+}
+
+void FTetherSimulation::PublishOutput()
+{
+	FTetherPhysicsOutput& Output = Outputs.GetWriteBuffer();
+	Output.TickCount = PhysicsUpdate.TickCount;
+	Output.SimulatedTime = PhysicsUpdate.GetSimulatedTime();
+	Output.InterpolationAlpha = PhysicsUpdate.GetInterpolationAlpha();
+
+	Output.ShapeTransforms.SetNumUninitialized(Shapes.Num());
+	for (int32 i = 0; i < Shapes.Num(); i++)
+	{
+		Output.ShapeTransforms[i] = Shapes[i]->GetAppliedWorldTransform();
+	}
+
+	// Before the first sub-tick there is nothing to interpolate from
+	Output.PreviousShapeTransforms = PreviousShapeTransforms.Num() == Shapes.Num() ? PreviousShapeTransforms :
+		Output.ShapeTransforms;
+
+	Outputs.Publish();
+}
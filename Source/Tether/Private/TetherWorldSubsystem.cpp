@@ -0,0 +1,128 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "TetherWorldSubsystem.h"
+
+#include "TetherSimulation.h"
+#include "TetherStatics.h"
+#include "Threading/TetherPhysicsPipeline.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherWorldSubsystem)
+
+DECLARE_CYCLE_STAT(TEXT("Tether_WorldSubsystem"), STAT_TetherWorldSubsystem, STATGROUP_Tether);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tether_WorldSubsystem_Simulations"), STAT_TetherWorldSubsystemSimulations, STATGROUP_Tether);
+
+void UTetherWorldSubsystem::RegisterSimulation(const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation)
+{
+	FScopeLock Lock(&PendingLock);
+	PendingSimulations.AddUnique(Simulation);
+}
+
+bool UTetherWorldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Editor preview worlds are included so anim nodes simulate in the animation editors
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE || WorldType == EWorldType::EditorPreview;
+}
+
+void UTetherWorldSubsystem::Deinitialize()
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		PendingSimulations.Empty();
+	}
+	Simulations.Empty();
+
+	Super::Deinitialize();
+}
+
+void UTetherWorldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_TetherWorldSubsystem);
+
+	// Add newly registered simulations
+	{
+		FScopeLock Lock(&PendingLock);
+		for (const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation : PendingSimulations)
+		{
+			Simulation->SharedData.InitializeSharedData();
+			Simulations.AddUnique(Simulation);
+		}
+		PendingSimulations.Reset();
+	}
+
+	// Drop simulations that were unregistered, or whose owner no longer references them
+	Simulations.RemoveAllSwap([](const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation)
+	{
+		return Simulation->IsPendingRemoval() || Simulation.GetSharedReferenceCount() == 1;
+	});
+
+	SET_DWORD_STAT(STAT_TetherWorldSubsystemSimulations, Simulations.Num());
+
+	if (Simulations.Num() == 0)
+	{
+		return;
+	}
+
+	// Start the frame with the current DeltaTime
+	for (const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation : Simulations)
+	{
+		Simulation->RefreshCollisionFilters();
+		Simulation->PhysicsUpdate.StartFrame(DeltaTime);
+	}
+
+	// Sub-tick every simulation that is due, all in the same batch, until none are due
+	TArray<FTetherSimulation*> Ticking;
+	TArray<FTetherPipelineContext> Batch;
+	for (;;)
+	{
+		Ticking.Reset();
+		Batch.Reset();
+		for (const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation : Simulations)
+		{
+			FTetherPhysicsUpdate& PhysicsUpdate = Simulation->PhysicsUpdate;
+			if (!PhysicsUpdate.ShouldTick())
+			{
+				continue;
+			}
+
+			Simulation->ApplyInputs();
+			Simulation->CapturePreviousTransforms();
+
+			FTetherPipelineContext& Context = Batch.AddDefaulted_GetRef();
+			Context.Shapes = &Simulation->Shapes;
+			Context.SharedData = &Simulation->SharedData;
+			Context.Origin = Simulation->Origin;
+			Context.DeltaTime = PhysicsUpdate.StepTime;
+			Context.WorldTime = PhysicsUpdate.GetSimulatedTime();
+			Ticking.Add(&Simulation.Get());
+		}
+
+		if (Batch.Num() == 0)
+		{
+			break;
+		}
+
+		FTetherPhysicsPipeline::TickBatch(Batch);
+
+		for (FTetherSimulation* Simulation : Ticking)
+		{
+			Simulation->PhysicsUpdate.FinalizeTick();
+		}
+	}
+
+	// Hand the results to the owners
+	for (const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation : Simulations)
+	{
+		if (Simulation->PhysicsUpdate.SubstepsThisFrame > 0)
+		{
+			Simulation->PublishOutput();
+		}
+	}
+}
+
+TStatId UTetherWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTetherWorldSubsystem, STATGROUP_Tickables);
+}
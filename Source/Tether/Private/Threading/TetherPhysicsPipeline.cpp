@@ -0,0 +1,373 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Threading/TetherPhysicsPipeline.h"
+
+#include "TetherPhysicsTypes.h"
+#include "Async/ParallelFor.h"
+#include "Physics/Collision/TetherCollisionDetectionBroadPhase.h"
+#include "Physics/Collision/TetherCollisionDetectionNarrowPhase.h"
+#include "Physics/Handlers/TetherActivityStateHandler.h"
+#include "Physics/Hashing/TetherHashing.h"
+#include "Physics/Solvers/TetherBodyStore.h"
+#include "Physics/Solvers/TetherIslands.h"
+#include "Physics/Solvers/Integration/TetherIntegrationSolver.h"
+#include "Physics/Solvers/Physics/TetherPhysicsSolverAngular.h"
+#include "Physics/Solvers/Physics/TetherPhysicsSolverLinear.h"
+#include "Tasks/Task.h"
+
+namespace FTether
+{
+	TAutoConsoleVariable<int32> CVarTetherPipelineMinBodiesPerChunk(TEXT("p.Tether.Pipeline.MinBodiesPerChunk"), 32, TEXT("Minimum number of bodies each worker processes per ParallelFor chunk when running the MultiThread pipeline, fewer bodies than this run on a single worker"));
+}
+
+void FTetherPhysicsPipeline::Tick(ETetherPhysicsUpdateMode Mode, TArray<FTetherShape*>& Shapes,
+	FTetherCommonSharedData& SharedData, const FTransform& Origin, float DeltaTime, double WorldTime)
+{
+	Prepare(SharedData);
+
+	if (Mode == ETetherPhysicsUpdateMode::MultiThread)
+	{
+		TickTasks(Shapes, SharedData, Origin, DeltaTime, WorldTime);
+	}
+	else
+	{
+		TickSerial(Shapes, SharedData, Origin, DeltaTime, WorldTime);
+	}
+
+	// Every stage has completed, safe to hand contact events to listeners
+	SharedData.BroadPhaseOutput.PairCache.BroadcastContactEvents();
+}
+
+void FTetherPhysicsPipeline::TickBatch(TConstArrayView<FTetherPipelineContext> Batch)
+{
+	const FTetherBodyRange AllBodies;
+
+	// Hashing, broad-phase and wake for every simulation
+	ParallelFor(Batch.Num(), [&](int32 Index)
+	{
+		const FTetherPipelineContext& Context = Batch[Index];
+		FTetherCommonSharedData& SharedData = *Context.SharedData;
+
+		Prepare(SharedData);
+		Hash(*Context.Shapes, SharedData, Context.Origin, Context.DeltaTime, Context.WorldTime);
+		BroadPhase(SharedData, Context.DeltaTime, Context.WorldTime);
+		Wake(SharedData, AllBodies, Context.DeltaTime, Context.WorldTime);
+		Gather(SharedData);
+	});
+
+	// Linear and angular solvers for every simulation
+	ParallelFor(Batch.Num(), [&](int32 Index)
+	{
+		const FTetherPipelineContext& Context = Batch[Index];
+		SolveLinear(*Context.SharedData, AllBodies, Context.DeltaTime, Context.WorldTime);
+		SolveAngular(*Context.SharedData, AllBodies, Context.DeltaTime, Context.WorldTime);
+	});
+
+	// Sleep, integration, narrow-phase and islands for every simulation
+	ParallelFor(Batch.Num(), [&](int32 Index)
+	{
+		const FTetherPipelineContext& Context = Batch[Index];
+		FTetherCommonSharedData& SharedData = *Context.SharedData;
+		
+		Sleep(SharedData, AllBodies, Context.DeltaTime, Context.WorldTime);
+		for (const int32 Island : SharedData.Islands.GetActiveIslands())
+		{
+			SolveIsland(SharedData, Island, Context.DeltaTime, Context.WorldTime);
+		}
+		SharedData.Bodies.RefreshPartition(ETetherBodyPartition::Awake);
+		NarrowPhase(SharedData, Context.DeltaTime, Context.WorldTime);
+		BuildIslands(SharedData);
+	});
+
+	// Every stage has completed, safe to hand contact events to listeners
+	for (const FTetherPipelineContext& Context : Batch)
+	{
+		Context.SharedData->BroadPhaseOutput.PairCache.BroadcastContactEvents();
+	}
+}
+
+void FTetherPhysicsPipeline::TickSerial(TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData,
+	const FTransform& Origin, float DeltaTime, double WorldTime)
+{
+	const FTetherBodyRange AllBodies;
+	
+	Hash(Shapes, SharedData, Origin, DeltaTime, WorldTime);
+	BroadPhase(SharedData, DeltaTime, WorldTime);
+	Wake(SharedData, AllBodies, DeltaTime, WorldTime);
+	Gather(SharedData);
+	SolveLinear(SharedData, AllBodies, DeltaTime, WorldTime);
+	SolveAngular(SharedData, AllBodies, DeltaTime, WorldTime);
+	Sleep(SharedData, AllBodies, DeltaTime, WorldTime);
+	for (const int32 Island : SharedData.Islands.GetActiveIslands())
+	{
+		SolveIsland(SharedData, Island, DeltaTime, WorldTime);
+	}
+	SharedData.Bodies.RefreshPartition(ETetherBodyPartition::Awake);
+	NarrowPhase(SharedData, DeltaTime, WorldTime);
+	BuildIslands(SharedData);
+}
+
+void FTetherPhysicsPipeline::TickTasks(TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData,
+	const FTransform& Origin, float DeltaTime, double WorldTime)
+{
+	using namespace UE::Tasks;
+
+	const int32 NumBodies = SharedData.Bodies.Num();
+
+	// Hashing and broad-phase are whole-simulation stages, each runs on a single worker
+	FTask HashTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		Hash(Shapes, SharedData, Origin, DeltaTime, WorldTime);
+	});
+
+	FTask BroadPhaseTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		BroadPhase(SharedData, DeltaTime, WorldTime);
+	}, HashTask);
+
+	// Waking depends on the broad-phase because recent broad-phase collisions wake sleeping shapes
+	FTask WakeTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		// Only asleep bodies can wake, the ranges are slots in the asleep partition
+		ParallelForBodies(SharedData.Bodies.AsleepBodies.Num(), [&](const FTetherBodyRange& Range)
+		{
+			Wake(SharedData, Range, DeltaTime, WorldTime);
+		});
+
+		// Gathering moves bodies between partitions and builds the sorted list of active bodies, so it isn't split
+		Gather(SharedData);
+	}, BroadPhaseTask);
+
+	// Linear and angular solvers write to separate arrays, so they run concurrently
+	FTask LinearTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		ParallelForBodies(NumBodies, [&](const FTetherBodyRange& Range)
+		{
+			SolveLinear(SharedData, Range, DeltaTime, WorldTime);
+		});
+	}, WakeTask);
+
+	FTask AngularTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		ParallelForBodies(NumBodies, [&](const FTetherBodyRange& Range)
+		{
+			SolveAngular(SharedData, Range, DeltaTime, WorldTime);
+		});
+	}, WakeTask);
+
+	// Each body decides whether it is ready to sleep on its own
+	FTask SleepTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		ParallelForBodies(NumBodies, [&](const FTetherBodyRange& Range)
+		{
+			Sleep(SharedData, Range, DeltaTime, WorldTime);
+		});
+	}, Prerequisites(LinearTask, AngularTask));
+
+	// Islands don't interact, so each island is an independent work item that sleeps or wakes as a unit
+	// Islands without an awake body are skipped entirely
+	FTask IslandTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		const TConstArrayView<int32> Islands = SharedData.Islands.GetActiveIslands();
+		ParallelFor(Islands.Num(), [&](int32 Index)
+		{
+			SolveIsland(SharedData, Islands[Index], DeltaTime, WorldTime);
+		});
+	}, SleepTask);
+
+	FTask NarrowPhaseTask = Launch(UE_SOURCE_LOCATION, [&]
+	{
+		SharedData.Bodies.RefreshPartition(ETetherBodyPartition::Awake);
+		NarrowPhase(SharedData, DeltaTime, WorldTime);
+		BuildIslands(SharedData);
+	}, IslandTask);
+
+	// The sub-tick must be complete before the caller moves on, the calling thread helps out while waiting
+	NarrowPhaseTask.Wait();
+}
+
+void FTetherPhysicsPipeline::ParallelForBodies(int32 NumBodies, TFunctionRef<void(const FTetherBodyRange&)> Func)
+{
+	const int32 MinBodiesPerChunk = FMath::Max(1, FTether::CVarTetherPipelineMinBodiesPerChunk.GetValueOnAnyThread());
+	const int32 NumChunks = FMath::Clamp(NumBodies / MinBodiesPerChunk, 1, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()));
+	const int32 ChunkSize = FMath::DivideAndRoundUp(NumBodies, NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 Begin = Chunk * ChunkSize;
+		Func(FTetherBodyRange(Begin, FMath::Min(Begin + ChunkSize, NumBodies)));
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void FTetherPhysicsPipeline::Prepare(FTetherCommonSharedData& SharedData)
+{
+	const FTetherBodyStore& Bodies = SharedData.Bodies;
+
+	// Update in preparation for Narrow-Phase, up front so the per-shape stages don't write to shared arrays
+	SharedData.NarrowPhaseInput.LinearOutputs.SetNumUninitialized(Bodies.Num());
+	SharedData.NarrowPhaseInput.AngularOutputs.SetNumUninitialized(Bodies.Num());
+	for (int32 i = 0; i < Bodies.Num(); i++)
+	{
+		SharedData.NarrowPhaseInput.LinearOutputs[i] = &Bodies.ShapeData[i]->LinearOutput;
+		SharedData.NarrowPhaseInput.AngularOutputs[i] = &Bodies.ShapeData[i]->AngularOutput;
+	}
+
+	// Hashing looks pair exclusions up by SimulationIndex, which changes when shapes are added or removed
+	SharedData.IgnoreMatrix.Build(Bodies.Shapes);
+
+	// Islands come from the previous sub-tick's contacts, start with every body on its own if there are none yet
+	if (!SharedData.Islands.IsValidFor(Bodies.Num()))
+	{
+		SharedData.Islands.Build(Bodies, {});
+	}
+}
+
+void FTetherPhysicsPipeline::Hash(TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData,
+	const FTransform& Origin, float DeltaTime, double WorldTime)
+{
+	/* Spatial Hashing - Generate shape pairs based on proximity and efficiency ratings for priority */
+	if (SharedData.Solvers.CurrentHashingSystem)
+	{
+		SharedData.Solvers.CurrentHashingSystem->Solve(&Shapes, &SharedData.SpatialHashingInput,
+			&SharedData.SpatialHashingOutput, Origin, DeltaTime, WorldTime);
+	}
+}
+
+void FTetherPhysicsPipeline::BroadPhase(FTetherCommonSharedData& SharedData, float DeltaTime, double WorldTime)
+{
+	/* Solve Broad-Phase Collision */
+	if (SharedData.Solvers.CurrentBroadPhaseCollisionDetection)
+	{
+		// Common optimization step where you quickly check if objects are close enough to potentially collide.
+		// It reduces the number of detailed collision checks needed in the narrow phase.
+		SharedData.Solvers.CurrentBroadPhaseCollisionDetection->DetectCollision(&SharedData.BroadPhaseInput,
+			&SharedData.BroadPhaseOutput, SharedData.Solvers.CurrentCollisionDetectionHandler, DeltaTime, WorldTime);
+	}
+}
+
+void FTetherPhysicsPipeline::Wake(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range,
+	float DeltaTime, double WorldTime)
+{
+	/* Pre-Solve Activity State (Wake) */
+	const FTetherBodyStore& Bodies = SharedData.Bodies;
+	const TArray<int32>& AsleepBodies = Bodies.AsleepBodies;
+	for (int32 Slot = Range.Begin; Slot < Range.GetEnd(AsleepBodies.Num()); Slot++)
+	{
+		const int32 i = AsleepBodies[Slot];
+		FTetherCommonShapeData* Data = Bodies.ShapeData[i];
+		if (Data->Solvers.CurrentActivityStateHandler)
+		{
+			Data->Solvers.CurrentActivityStateHandler->PreSolveWake(Bodies.Shapes[i], &Data->ActivityInput,
+				&Data->LinearInput, &Data->AngularInput, DeltaTime, WorldTime);
+		}
+	}
+}
+
+void FTetherPhysicsPipeline::Gather(FTetherCommonSharedData& SharedData)
+{
+	// Move the bodies that woke into the awake partition, then gather and find their islands
+	SharedData.Bodies.RefreshPartition(ETetherBodyPartition::Asleep);
+	SharedData.Bodies.Gather();
+	SharedData.Islands.GatherActive(SharedData.Bodies.ActiveBodies);
+}
+
+void FTetherPhysicsPipeline::SolveLinear(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range,
+	float DeltaTime, double WorldTime)
+{
+	for (const UTetherPhysicsSolverLinear* LinearSolver : SharedData.Bodies.UniqueLinearSolvers)
+	{
+		LinearSolver->SolveAll(SharedData.Bodies, DeltaTime, WorldTime, Range);
+	}
+}
+
+void FTetherPhysicsPipeline::SolveAngular(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range,
+	float DeltaTime, double WorldTime)
+{
+	for (const UTetherPhysicsSolverAngular* AngularSolver : SharedData.Bodies.UniqueAngularSolvers)
+	{
+		AngularSolver->SolveAll(SharedData.Bodies, DeltaTime, WorldTime, Range);
+	}
+}
+
+void FTetherPhysicsPipeline::Sleep(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range,
+	float DeltaTime, double WorldTime)
+{
+	FTetherBodyStore& Bodies = SharedData.Bodies;
+	Bodies.ScatterVelocities(Range);
+
+	/* Post-Solve Activity State (Sleep) */
+	for (const int32 i : Bodies.GetActiveBodies(Range))
+	{
+		FTetherCommonShapeData* Data = Bodies.ShapeData[i];
+		if (Data->Solvers.CurrentActivityStateHandler)
+		{
+			Data->Solvers.CurrentActivityStateHandler->PostSolveSleep(Bodies.Shapes[i], &Data->ActivityInput,
+				&Data->LinearInput, &Data->AngularInput, &Data->LinearOutput, &Data->AngularOutput, DeltaTime, WorldTime);
+		}
+	}
+}
+
+void FTetherPhysicsPipeline::SolveIsland(FTetherCommonSharedData& SharedData, int32 Island, float DeltaTime,
+	double WorldTime)
+{
+	FTetherBodyStore& Bodies = SharedData.Bodies;
+	const TConstArrayView<int32> IslandBodies = SharedData.Islands.GetIsland(Island);
+
+	// The island only sleeps once all of its bodies are at rest
+	UTetherActivityStateHandler::SynchronizeIsland(Bodies, IslandBodies);
+
+	for (const int32 i : IslandBodies)
+	{
+		// Resting bodies stay exactly where they are
+		if (Bodies.Shapes[i]->IsAsleep())
+		{
+			continue;
+		}
+
+		// Sleeping may have modified the velocities, and bodies woken by the island weren't gathered
+		const FTetherBodyRange Body(i, i + 1);
+		Bodies.GatherTransforms(Body);
+		Bodies.GatherVelocities(Body);
+		Integrate(SharedData, Body, DeltaTime, WorldTime);
+	}
+}
+
+void FTetherPhysicsPipeline::Integrate(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range,
+	float DeltaTime, double WorldTime)
+{
+	FTetherBodyStore& Bodies = SharedData.Bodies;
+	for (const UTetherIntegrationSolver* IntegrationSolver : Bodies.UniqueIntegrationSolvers)
+	{
+		IntegrationSolver->SolveAll(Bodies, DeltaTime, WorldTime, Range);
+	}
+
+	for (int32 i = Range.Begin; i < Range.GetEnd(Bodies.Num()); i++)
+	{
+		FTetherShape* Shape = Bodies.Shapes[i];
+		FTetherCommonShapeData* Data = Bodies.ShapeData[i];
+
+		// Update shape with new transform
+		if (Data->Solvers.CurrentIntegrationSolver)
+		{
+			Shape->ToWorldSpace(Data->IntegrationOutput.Transform);
+		}
+	}
+}
+
+void FTetherPhysicsPipeline::NarrowPhase(FTetherCommonSharedData& SharedData, float DeltaTime, double WorldTime)
+{
+	// This step checks for actual collisions using detailed geometry after the object has been moved.
+	// It's a more precise and computationally expensive check compared to the broad phase.
+	if (SharedData.Solvers.CurrentNarrowPhaseCollisionDetection)
+	{
+		SharedData.Solvers.CurrentNarrowPhaseCollisionDetection->DetectCollision(&SharedData.NarrowPhaseInput,
+			&SharedData.NarrowPhaseOutput, SharedData.Solvers.CurrentCollisionDetectionHandler, DeltaTime, WorldTime);
+	}
+}
+
+void FTetherPhysicsPipeline::BuildIslands(FTetherCommonSharedData& SharedData)
+{
+	// Union-find over this sub-tick's contacts, used by the next sub-tick
+	SharedData.Islands.Build(SharedData.Bodies, SharedData.NarrowPhaseOutput.Collisions);
+}
@@ -5,6 +5,18 @@
 
 #include "TetherStatics.h"
 
+namespace FTether
+{
+	/** Event waits have millisecond granularity, so the remainder before a deadline is spent yielding */
+	static constexpr double PhysicsThreadSpinTime = 0.002;
+
+	/** Fraction of a time tick the thread can wake past its deadline before it is considered late */
+	static constexpr double PhysicsThreadLateTolerance = 0.25;
+
+	/** How long to wait between checks while paused, Kick() resumes sooner */
+	static constexpr uint32 PhysicsThreadPausedWaitMs = 100;
+}
+
 FTetherPhysicsRunnable* FTetherPhysicsRunnable::Create(UObject* InThreadOwner, float InSimulationFrameRate, EThreadPriority ThreadPriority, uint32 StackSize)
 {
 	// Don't try to init if owner is being GC'd
@@ -49,7 +61,14 @@ FTetherPhysicsRunnable* FTetherPhysicsRunnable::Create(UObject* InThreadOwner, f
 FTetherPhysicsRunnable::FTetherPhysicsRunnable(UObject* InThreadOwner, float InSimulationFrameRate, EThreadPriority ThreadPriority, uint32 StackSize)
 	: ThreadOwner(InThreadOwner)
 	, Thread(nullptr)
+	, WakeEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	, bInputPending(false)
 	, bShouldStop(false)
+	, StatTickCount(0)
+	, StatLateTicks(0)
+	, StatOverruns(0)
+	, StatOverflows(0)
+	, StatMaxLateness(0.0)
 	, PhysicsUpdate(InSimulationFrameRate)
 {
 	LastStackSize = StackSize;
@@ -78,6 +97,9 @@ FTetherPhysicsRunnable::~FTetherPhysicsRunnable()
 		delete Thread;
 		Thread = nullptr;
 	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
 }
 
 bool FTetherPhysicsRunnable::Init()
@@ -89,56 +111,198 @@ bool FTetherPhysicsRunnable::Init()
 
 uint32 FTetherPhysicsRunnable::Run()
 {
+	const double TimeTick = PhysicsUpdate.TimeTick;
 	double LastTime = FPlatformTime::Seconds();
+	double Deadline = LastTime + TimeTick;
 	
 	// Main thread loop
 	while (!ShouldStop())
 	{
+		if (ThreadInterface->IsPhysicsSimulationPaused())
+		{
+			// Don't accumulate time while paused, otherwise we would burst through sub-ticks when resumed
+			WakeEvent->Wait(FTether::PhysicsThreadPausedWaitMs);
+			LastTime = FPlatformTime::Seconds();
+			Deadline = LastTime + TimeTick;
+			continue;
+		}
+
+		// Wait for the next deadline, or until kicked
+		const bool bKicked = WaitUntil(Deadline);
+		if (ShouldStop())
+		{
+			break;
+		}
+
 		// Get the current time
-		double CurrentTime = FPlatformTime::Seconds();
-        
-		// Calculate DeltaTime
-		float DeltaTime = static_cast<float>(CurrentTime - LastTime);
-		
-		// Update LastTime for the next iteration
+		const double CurrentTime = FPlatformTime::Seconds();
+
+		if (!bKicked)
+		{
+			// Track how late the OS woke us
+			const double Lateness = CurrentTime - Deadline;
+			if (Lateness > TimeTick * FTether::PhysicsThreadLateTolerance)
+			{
+				++StatLateTicks;
+			}
+			if (Lateness > StatMaxLateness.load(std::memory_order_relaxed))
+			{
+				StatMaxLateness.store(Lateness, std::memory_order_relaxed);
+			}
+		}
+
+		// Start the frame with the time elapsed since the last frame
+		PhysicsUpdate.StartFrame(static_cast<float>(CurrentTime - LastTime));
 		LastTime = CurrentTime;
 
-		// Start the frame with the current DeltaTime
-		PhysicsUpdate.StartFrame(DeltaTime);
+		if (PhysicsUpdate.bOverflowed)
+		{
+			++StatOverflows;
+		}
+
+		// Apply input straight away, we may have been kicked for it well before a sub-tick is due
+		ApplyPendingInputs();
 
 		// Update at consistent framerate (default 60fps)
+		const double SimulatedTimeBefore = PhysicsUpdate.GetSimulatedTime();
 		while (PhysicsUpdate.ShouldTick())
 		{
+			// Apply anything the game thread sent since the last sub-tick
+			ApplyPendingInputs();
+
 			// Physics update logic here
-			if (!ThreadInterface->IsPhysicsSimulationPaused())
-			{
-				ThreadInterface->TickPhysics(PhysicsUpdate.TimeTick);
-			}
+			ThreadInterface->TickPhysics(PhysicsUpdate.StepTime);
 			PhysicsUpdate.FinalizeTick();
 		}
 
-		// Sleep or yield to prevent 100% CPU usage
-		FPlatformProcess::Sleep(0.01f);
+		// Publish the results to the game thread
+		if (PhysicsUpdate.SubstepsThisFrame > 0)
+		{
+			FTetherPhysicsOutput& Output = OutputBuffer.GetWriteBuffer();
+			ThreadInterface->WritePhysicsOutput(Output);
+			Output.TickCount = PhysicsUpdate.TickCount;
+			Output.SimulatedTime = PhysicsUpdate.GetSimulatedTime();
+			Output.InterpolationAlpha = PhysicsUpdate.GetInterpolationAlpha();
+			OutputBuffer.Publish();
+		}
+
+		StatTickCount.store(PhysicsUpdate.TickCount, std::memory_order_relaxed);
+
+		// Simulating took longer than the time it simulated, we can't keep up
+		const double FinishTime = FPlatformTime::Seconds();
+		const double SimulatedThisFrame = PhysicsUpdate.GetSimulatedTime() - SimulatedTimeBefore;
+		if (PhysicsUpdate.SubstepsThisFrame > 0 && FinishTime - CurrentTime > SimulatedThisFrame)
+		{
+			++StatOverruns;
+		}
+
+		// The next deadline is when the accumulator reaches a full time tick again
+		// It is anchored to the time the frame started rather than the time we finished, so it doesn't drift
+		Deadline = CurrentTime + FMath::Max(0.0, TimeTick - PhysicsUpdate.RemainingTime);
 	}
 
 	return 0;
 }
 
+bool FTetherPhysicsRunnable::WaitUntil(double Deadline) const
+{
+	while (!ShouldStop())
+	{
+		const double Remaining = Deadline - FPlatformTime::Seconds();
+		if (Remaining <= 0.0)
+		{
+			return false;
+		}
+
+		if (Remaining > FTether::PhysicsThreadSpinTime)
+		{
+			// Block until shortly before the deadline, return early if kicked
+			const uint32 WaitMs = static_cast<uint32>((Remaining - FTether::PhysicsThreadSpinTime) * 1000.0);
+			if (WaitMs > 0 && WakeEvent->Wait(WaitMs))
+			{
+				return true;
+			}
+		}
+		else
+		{
+			// Too close to the deadline to trust the event's granularity
+			FPlatformProcess::YieldThread();
+		}
+	}
+	return false;
+}
+
+void FTetherPhysicsRunnable::ApplyPendingInputs()
+{
+	// Cleared before draining, so input queued after this point kicks us again
+	bInputPending.store(false);
+
+	FTetherPhysicsInput Input;
+	while (InputQueue.Dequeue(Input))
+	{
+		ThreadInterface->ApplyPhysicsInput(Input);
+	}
+}
+
 void FTetherPhysicsRunnable::Stop()
 {
-	// Set the stop flag to true
-	FScopeLock Lock(&Mutex);
+	// Set the stop flag to true and wake the thread so it exits promptly
 	bShouldStop = true;
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FTetherPhysicsRunnable::EnqueueInput(FTetherPhysicsInput&& Input)
+{
+	// Only the first input since the thread last drained the queue needs to wake it
+	InputQueue.Enqueue(MoveTemp(Input));
+	if (!bInputPending.exchange(true))
+	{
+		Kick();
+	}
+}
+
+void FTetherPhysicsRunnable::EnqueueInput(const FTetherPhysicsInput& Input)
+{
+	EnqueueInput(FTetherPhysicsInput(Input));
+}
+
+const FTetherPhysicsOutput* FTetherPhysicsRunnable::ReadLatestOutput()
+{
+	OutputBuffer.Update();
+	return OutputBuffer.HasReadBuffer() ? &OutputBuffer.GetReadBuffer() : nullptr;
+}
+
+void FTetherPhysicsRunnable::Kick()
+{
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+FTetherPhysicsThreadStats FTetherPhysicsRunnable::GetStats() const
+{
+	FTetherPhysicsThreadStats Stats;
+	Stats.TickCount = StatTickCount.load(std::memory_order_relaxed);
+	Stats.LateTicks = StatLateTicks.load(std::memory_order_relaxed);
+	Stats.Overruns = StatOverruns.load(std::memory_order_relaxed);
+	Stats.Overflows = StatOverflows.load(std::memory_order_relaxed);
+	Stats.MaxLateness = StatMaxLateness.load(std::memory_order_relaxed);
+	return Stats;
 }
 
 void FTetherPhysicsRunnable::Exit()
 {
 	// Cleanup logic here
-	UE_LOG(LogTether, Log, TEXT("FTetherPhysicsRunnable Exiting"));
+	const FTetherPhysicsThreadStats Stats = GetStats();
+	UE_LOG(LogTether, Log, TEXT("FTetherPhysicsRunnable Exiting. Ticks: %lld, Late: %lld, Overruns: %lld, Overflows: %lld, Max Lateness: %.3fms"),
+		Stats.TickCount, Stats.LateTicks, Stats.Overruns, Stats.Overflows, Stats.MaxLateness * 1000.0);
 }
 
 bool FTetherPhysicsRunnable::ShouldStop() const
 {
-	FScopeLock Lock(&Mutex);
-	return bShouldStop || !IsValid(ThreadOwner);
+	return bShouldStop.load() || !IsValid(ThreadOwner);
 }
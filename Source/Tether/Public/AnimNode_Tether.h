@@ -16,6 +16,39 @@ class UTetherPhysicsSolverLinear;
 class UTetherCollisionDetectionNarrowPhase;
 class UTetherCollisionDetectionBroadPhase;
 class UTetherHashing;
+class UPhysicsAsset;
+struct FTetherSimulation;
+struct FTetherBodyColliders;
+struct FTetherPhysicsOutput;
+
+/**
+ * A bone simulated as a sphere that springs towards its animated location and collides with the other shapes
+ * Only the bone's location is simulated, it keeps its animated rotation
+ */
+USTRUCT(BlueprintType)
+struct TETHER_API FTetherSimulatedBone
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category=Tether)
+	FBoneReference Bone;
+
+	/** Radius of the sphere that represents the bone */
+	UPROPERTY(EditAnywhere, Category=Tether, meta=(UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float Radius = 5.f;
+
+	/** Spring acceleration per cm from the animated location, higher values follow the animation more closely */
+	UPROPERTY(EditAnywhere, Category=Tether, meta=(UIMin="0", ClampMin="0"))
+	float Stiffness = 400.f;
+
+	/** 1 settles without overshooting, lower values overshoot and wobble */
+	UPROPERTY(EditAnywhere, Category=Tether, meta=(UIMin="0", ClampMin="0", UIMax="2"))
+	float DampingRatio = 0.5f;
+
+	/** Mass, gravity, damping and velocity limit of the bone's sphere */
+	UPROPERTY(EditAnywhere, Category=Tether)
+	FLinearInputSettings LinearSettings;
+};
 
 /**
  * Tether's core functionality
@@ -28,6 +61,15 @@ struct TETHER_API FAnimNode_Tether : public FAnimNode_SkeletalControlBase
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, Categories="Tether.Hashing"))
 	FGameplayTag HashingSystem = FTetherGameplayTags::Tether_Hashing_Spatial;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, Categories="Tether.Detection.CollisionHandler"))
+	FGameplayTag CollisionDetectionHandler = FTetherGameplayTags::Tether_Detection_CollisionHandler;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, Categories="Tether.Detection.BroadPhase"))
+	FGameplayTag BroadPhaseCollisionDetection = FTetherGameplayTags::Tether_Detection_BroadPhase;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, Categories="Tether.Detection.NarrowPhase"))
+	FGameplayTag NarrowPhaseCollisionDetection = FTetherGameplayTags::Tether_Detection_NarrowPhase;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, Categories="Tether.Solver.Linear"))
 	FGameplayTag LinearSolver = FTetherGameplayTags::Tether_Solver_Linear;
@@ -52,21 +94,94 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, ClampMin="1", UIMin="1", UIMax="120"))
 	float SimulationFrameRate = 60.f;
 
+	/**
+	 * Maximum number of simulation sub-ticks per frame, 0 is unlimited
+	 * Prevents a hitch from causing ever longer frames as the simulation tries to catch up
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, ClampMin="0", UIMin="0", UIMax="16"))
+	int32 MaxSubsteps = 4;
+
+	/** What to do with the time that exceeds MaxSubsteps */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault))
+	ETetherSubstepOverflow SubstepOverflow = ETetherSubstepOverflow::Drop;
+
+	/**
+	 * Simulate in UTetherWorldSubsystem, batched with every other Tether node in the world, rather than on the
+	 * anim thread that evaluates this node. Results are a frame behind the pose.
+	 */
+	UPROPERTY(EditAnywhere, Category=Tether)
+	bool bBatchSimulation = false;
+
 	UPROPERTY(EditAnywhere, Category=Tether)
 	FBoneReference RootBone;
+
+	/**
+	 * Import the sphyls, spheres and boxes of the physics asset as kinematic shapes that follow their bones, so
+	 * the simulated bones collide with the character's body without any Chaos scene queries
+	 */
+	UPROPERTY(EditAnywhere, Category=Tether)
+	bool bImportBodyColliders = false;
+
+	/** Physics asset to import body colliders from, uses the skeletal mesh's physics asset if unset */
+	UPROPERTY(EditAnywhere, Category=Tether, meta=(EditCondition="bImportBodyColliders"))
+	TObjectPtr<UPhysicsAsset> BodyColliderAsset = nullptr;
+
+	/** Bones simulated as spheres, in the same simulation as the body colliders */
+	UPROPERTY(EditAnywhere, Category=Tether)
+	TArray<FTetherSimulatedBone> SimulatedBones;
 	
 protected:
 	/** Used to prevent Evaluate() running logic before the first update */
 	UPROPERTY()
 	bool bFirstUpdate = true;
 
-	FTetherPhysicsUpdate PhysicsUpdate = { SimulationFrameRate };
+	/**
+	 * The body colliders and simulated bones, registered with UTetherWorldSubsystem when bBatchSimulation is enabled,
+	 * otherwise ticked by this node on the anim thread
+	 */
+	TSharedPtr<FTetherSimulation, ESPMode::ThreadSafe> Simulation;
+
+	/** Whether Simulation is registered with the subsystem rather than ticked by this node */
+	bool bSimulationRegistered = false;
+
+	/**
+	 * Build the simulation from this node's settings, with its own copy of the body colliders and a sphere for each
+	 * simulated bone
+	 */
+	void BuildSimulation();
+
+	/** Build the simulation and register it with the world's subsystem */
+	void RegisterSimulation(const UWorld* World);
+
+	/** Stop the subsystem simulating on our behalf, and release the simulation either way */
+	void UnregisterSimulation();
+
+	/** Queue the animated location of each simulated bone as its drive target */
+	void DriveSimulatedBones(FCSPose<FCompactPose>& Pose, const FTransform& ComponentTransform);
+
+	/** Move each simulated bone to its sphere, interpolated between the output's previous and current states */
+	void ApplySimulatedBones(FCSPose<FCompactPose>& Pose, const FTransform& ComponentTransform,
+		const FTetherPhysicsOutput& SimulationOutput, TArray<FBoneTransform>& OutBoneTransforms) const;
+
+	/** Kinematic shapes imported from the physics asset, each simulation is given its own copy */
+	TSharedPtr<FTetherBodyColliders, ESPMode::ThreadSafe> BodyColliders;
+
+	/** SimulationIndex of each simulated bone's sphere */
+	TArray<int32> SimulatedBoneShapes;
+
+	/** The spheres are moved straight to their bones when the simulation is built, rather than springing there */
+	bool bTeleportSimulatedBones = true;
 
 protected:
 	FCompactPoseBoneIndex RootBoneIndex = FCompactPoseBoneIndex(INDEX_NONE);
+
+	/** Compact pose index of each simulated bone */
+	TArray<FCompactPoseBoneIndex> SimulatedBoneIndices;
 	
 protected:
 	// FAnimNode_SkeletalControlBase interface
+	virtual bool NeedsOnInitializeAnimInstance() const override { return true; }
+	virtual void OnInitializeAnimInstance(const FAnimInstanceProxy* InProxy, const UAnimInstance* InAnimInstance) override;
 	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
 	virtual void UpdateInternal(const FAnimationUpdateContext& Context) override;
 	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
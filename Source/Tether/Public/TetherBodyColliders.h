@@ -0,0 +1,79 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BoneContainer.h"
+#include "BonePose.h"
+#include "TetherPhysicsTypes.h"
+#include "Shapes/TetherShape_BoundingSphere.h"
+#include "Shapes/TetherShape_Capsule.h"
+#include "Shapes/TetherShape_OrientedBoundingBox.h"
+
+class UPhysicsAsset;
+struct FTetherSimulation;
+
+/**
+ * Kinematic Tether shapes imported from the bodies of a physics asset, each following its body's bone
+ *
+ * Sphyls become capsules, spheres become bounding spheres and boxes become oriented bounding boxes, built in bone space.
+ * UpdateFromPose() moves every collider to its bone in a single pass over the component space pose, so the shapes
+ * simulated alongside them collide with the character's body in Tether's narrow phase without any Chaos scene queries.
+ * Convex and tapered capsule elements are not imported.
+ *
+ * Colliders are indexed spheres first, then capsules, then boxes. A simulation gets its own copy of each collider, the
+ * imported shapes are only a template, so a registered simulation never shares shapes with the anim thread.
+ */
+struct TETHER_API FTetherBodyColliders
+{
+	/** Build a collider for every sphyl, sphere and box in the physics asset, replacing any previous import */
+	void Import(const UPhysicsAsset* PhysicsAsset);
+
+	void Reset();
+
+	/** Resolve each collider's bone, colliders whose bone isn't required by the current LOD aren't moved */
+	void InitializeBoneReferences(const FBoneContainer& RequiredBones);
+
+	/** Add a copy of every collider to the simulation, before it is registered, replacing any previous simulation */
+	void AddToSimulation(FTetherSimulation& Simulation);
+
+	/**
+	 * Move every collider's copy in the simulation to its bone, queued as kinematic inputs
+	 * @param Pose                Component space pose to read the bones from
+	 * @param ComponentTransform  World transform of the skeletal mesh component
+	 * @param Simulation          The simulation the colliders were added to by AddToSimulation()
+	 */
+	void UpdateFromPose(FCSPose<FCompactPose>& Pose, const FTransform& ComponentTransform, FTetherSimulation& Simulation);
+
+	int32 Num() const { return Bones.Num(); }
+	bool IsEmpty() const { return Bones.IsEmpty(); }
+
+	FTetherShape* GetShape(int32 Index);
+	const FTetherShape* GetShape(int32 Index) const { return const_cast<FTetherBodyColliders*>(this)->GetShape(Index); }
+
+	/** Bone the collider follows */
+	const FBoneReference& GetBone(int32 Index) const { return Bones[Index]; }
+
+	/** SimulationIndex of the collider's copy in the simulation it was last added to */
+	int32 GetSimulationIndex(int32 Index) const
+	{
+		return SimulationIndices.IsValidIndex(Index) ? SimulationIndices[Index] : INDEX_NONE;
+	}
+
+protected:
+	TArray<FTetherShape_BoundingSphere> Spheres;
+	TArray<FTetherShape_Capsule> Capsules;
+	TArray<FTetherShape_OrientedBoundingBox> Boxes;
+
+	/** Per-shape data for each collider */
+	TArray<FTetherCommonShapeData> ShapeData;
+
+	/** Bone each collider follows */
+	TArray<FBoneReference> Bones;
+
+	/** Compact pose index of each collider's bone, resolved by InitializeBoneReferences() */
+	TArray<FCompactPoseBoneIndex> BoneIndices;
+
+	/** SimulationIndex of each collider's copy, set by AddToSimulation() */
+	TArray<int32> SimulationIndices;
+};
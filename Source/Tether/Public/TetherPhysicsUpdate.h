@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "TetherPhysicsTypes.h"
 
 /**
  * Handles the timing and updates for physics simulations, ensuring consistent sub-ticks within a frame.
@@ -11,6 +12,13 @@
  * updates (sub-ticks) within a single frame if necessary. This ensures that the physics simulation remains stable
  * and consistent, even when frame rates vary.
  *
+ * The number of sub-ticks per frame is capped by MaxSubsteps, so a hitch can't cause a spiral of ever longer frames;
+ * OverflowPolicy decides what happens to the time that didn't fit. Time is accumulated in double precision and
+ * ElapsedTicks counts every time tick simulated, so long sessions don't drift.
+ *
+ * The time left over after the last sub-tick is exposed as an interpolation alpha, so presentation can blend between
+ * the previous and current simulated states, e.g. simulate at 30Hz and present smoothly at 120Hz.
+ *
  * Example Usage:
  * 
  * void AMyActor::Tick(float DeltaTime)
@@ -21,12 +29,16 @@
  *     // Update at a consistent framerate (e.g., 60fps)
  *     while (PhysicsUpdate.ShouldTick())
  *     {
- *         // Perform physics update logic here, using the fixed time step
- *         TickPhysics(PhysicsUpdate.TimeTick);
+ *         // Perform physics update logic here, using the step time (TimeTick unless the step is variable)
+ *         PreviousState = CurrentState;
+ *         TickPhysics(PhysicsUpdate.StepTime);
  *
  *         // Finalize the tick, preparing for the next potential sub-tick
  *         PhysicsUpdate.FinalizeTick();
  *     }
+ *
+ *     // Present a blend of the last two states
+ *     Present(PhysicsUpdate.Interpolate(PreviousState, CurrentState));
  * }
  */
 struct TETHER_API FTetherPhysicsUpdate
@@ -34,21 +46,59 @@ struct TETHER_API FTetherPhysicsUpdate
 	/** The fixed time step for each sub-tick, based on the desired simulation frame rate */
 	float TimeTick;
 
+	/** The time step for the current sub-tick, equal to TimeTick unless OverflowPolicy is VariableStep */
+	float StepTime;
+
 	/** The accumulated time since the last sub-tick, used to determine if a new sub-tick is needed */
-	float RemainingTime;
+	double RemainingTime;
+
+	/** Maximum number of sub-ticks per frame, 0 is unlimited */
+	int32 MaxSubsteps;
+
+	/** What to do with the time that exceeds MaxSubsteps */
+	ETetherSubstepOverflow OverflowPolicy;
+
+	/** Total number of sub-ticks that have been simulated */
+	int64 TickCount;
+
+	/** Total number of time ticks that have been simulated, a variable sub-tick spans several */
+	int64 ElapsedTicks;
+
+	/** Number of time ticks the current sub-tick spans */
+	int32 StepTicks;
+
+	/** Number of sub-ticks simulated during the current frame */
+	int32 SubstepsThisFrame;
 	
 	/** If false, we didn't entire the while loop even once */
 	bool bEverTicked;
+
+	/** True if the current frame needed more than MaxSubsteps sub-ticks */
+	bool bOverflowed;
+
+	/** Longest variable sub-tick in time ticks, larger steps are unstable so the excess is discarded */
+	static constexpr int32 MaxVariableStepTicks = 4;
 	
 	/**
 	 * Initialize the time tick and remaining time based on the simulation frame rate.
 	 * 
 	 * @param SimulationFrameRate The desired number of physics ticks per second.
+	 * @param InMaxSubsteps Maximum number of sub-ticks per frame, 0 is unlimited.
+	 * @param InOverflowPolicy What to do with the time that exceeds InMaxSubsteps.
 	 */
-	FTetherPhysicsUpdate(float SimulationFrameRate = 60.f)
+	FTetherPhysicsUpdate(float SimulationFrameRate = 60.f, int32 InMaxSubsteps = 4,
+		ETetherSubstepOverflow InOverflowPolicy = ETetherSubstepOverflow::Drop)
 		: TimeTick(1.f / SimulationFrameRate)	// Calculate the time per tick
-		, RemainingTime(0.f)					// Initialize the remaining time to zero
+		, StepTime(TimeTick)
+		, RemainingTime(0.0)					// Initialize the remaining time to zero
+		, MaxSubsteps(InMaxSubsteps)
+		, OverflowPolicy(InOverflowPolicy)
+		, TickCount(0)
+		, ElapsedTicks(0)
+		, StepTicks(1)
+		, SubstepsThisFrame(0)
 		, bEverTicked(false)
+		, bOverflowed(false)
 	{}
 
 	/**
@@ -60,6 +110,34 @@ struct TETHER_API FTetherPhysicsUpdate
 	{
 		// Accumulate the time since the last frame
 		RemainingTime += DeltaTime;
+		SubstepsThisFrame = 0;
+		bOverflowed = false;
+
+		if (MaxSubsteps > 0)
+		{
+			const double MaxFrameTime = MaxSubsteps * static_cast<double>(TimeTick);
+			if (RemainingTime >= MaxFrameTime + TimeTick)
+			{
+				bOverflowed = true;
+				switch (OverflowPolicy)
+				{
+				case ETetherSubstepOverflow::Drop:
+					// Discard everything we can't simulate this frame
+					RemainingTime = MaxFrameTime;
+					break;
+				case ETetherSubstepOverflow::SlowMotion:
+					// Carry the rest over, but never more than another frame's worth
+					RemainingTime = FMath::Min(RemainingTime, MaxFrameTime * 2.0);
+					break;
+				case ETetherSubstepOverflow::VariableStep:
+					// The final sub-tick absorbs the excess, see ComputeStepTicks(), but no more than it can simulate
+					RemainingTime = FMath::Min(RemainingTime, (MaxSubsteps - 1 + MaxVariableStepTicks) * static_cast<double>(TimeTick));
+					break;
+				}
+			}
+		}
+
+		UpdateStepTime();
 		bEverTicked = ShouldTick();
 	}
 
@@ -70,7 +148,11 @@ struct TETHER_API FTetherPhysicsUpdate
 	 */
 	bool ShouldTick() const
 	{
-		return RemainingTime >= TimeTick;
+		if (MaxSubsteps > 0 && SubstepsThisFrame >= MaxSubsteps)
+		{
+			return false;
+		}
+		return RemainingTime >= StepTime;
 	}
 
 	/**
@@ -79,6 +161,51 @@ struct TETHER_API FTetherPhysicsUpdate
 	void FinalizeTick()
 	{
 		// Adjust the remaining time for the next sub-tick
-		RemainingTime -= TimeTick;
+		RemainingTime -= StepTime;
+		TickCount++;
+		ElapsedTicks += StepTicks;
+		SubstepsThisFrame++;
+		UpdateStepTime();
+	}
+
+	/** Total simulated time, computed from ElapsedTicks so it doesn't accumulate rounding errors */
+	double GetSimulatedTime() const
+	{
+		return ElapsedTicks * static_cast<double>(TimeTick);
+	}
+
+	/**
+	 * How far presentation is between the previous and current simulated states
+	 * @return 0 at the previous state, 1 at the current state
+	 */
+	float GetInterpolationAlpha() const
+	{
+		return TimeTick > 0.f ? FMath::Clamp<float>(RemainingTime / TimeTick, 0.f, 1.f) : 1.f;
+	}
+
+	/** Blends between the previous and current simulated transforms using GetInterpolationAlpha() */
+	FTransform Interpolate(const FTransform& Previous, const FTransform& Current) const
+	{
+		FTransform Result;
+		Result.Blend(Previous, Current, GetInterpolationAlpha());
+		return Result;
+	}
+
+protected:
+	int32 ComputeStepTicks() const
+	{
+		// The last permitted sub-tick of an overflowing frame consumes every whole tick that remains
+		if (OverflowPolicy == ETetherSubstepOverflow::VariableStep && MaxSubsteps > 0 &&
+			SubstepsThisFrame == MaxSubsteps - 1 && RemainingTime >= 2.0 * TimeTick)
+		{
+			return FMath::Clamp(static_cast<int32>(FMath::FloorToDouble(RemainingTime / TimeTick)), 1, MaxVariableStepTicks);
+		}
+		return 1;
+	}
+
+	void UpdateStepTime()
+	{
+		StepTicks = ComputeStepTicks();
+		StepTime = StepTicks * TimeTick;
 	}
 };
@@ -0,0 +1,139 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherPhysicsTypes.h"
+#include "TetherPhysicsUpdate.h"
+#include "Containers/Queue.h"
+#include "Threading/TetherThreadTypes.h"
+#include "Threading/TetherTripleBuffer.h"
+#include <atomic>
+
+/**
+ * A single simulation simulated by UTetherWorldSubsystem, e.g. one character's accessories
+ *
+ * The owner builds the simulation by assigning solvers and adding shapes, then registers it with the subsystem.
+ * From then on the subsystem owns the simulation state; the owner only talks to it through EnqueueInput() and
+ * ReadLatestOutput(), which never block, so the owner can run on any thread (e.g. an anim worker thread).
+ *
+ * Shapes added with AddShape() are not owned by the simulation and must outlive it, hand their owner to ShapeOwner
+ * when the owner can't guarantee that itself. AddShapeCopy() instead gives the simulation its own copy, which nothing
+ * else can touch once the simulation is registered.
+ * The subsystem drops the simulation once the owner releases its reference or calls Unregister().
+ */
+struct TETHER_API FTetherSimulation
+{
+	FTetherSimulation(float SimulationFrameRate = 60.f, int32 MaxSubsteps = 4,
+		ETetherSubstepOverflow OverflowPolicy = ETetherSubstepOverflow::Drop);
+
+	FTetherSimulation(const FTetherSimulation&) = delete;
+	FTetherSimulation& operator=(const FTetherSimulation&) = delete;
+
+	// Setup, only before registering
+
+	/** Shared solvers, hashing input, and the body store */
+	FTetherCommonSharedData SharedData;
+
+	/** Origin for the hashing system */
+	FTransform Origin = FTransform::Identity;
+
+	/** Kept alive for as long as the subsystem holds the simulation, e.g. whatever owns the shapes */
+	TSharedPtr<void, ESPMode::ThreadSafe> ShapeOwner;
+
+	/**
+	 * Add a shape to the simulation, assigning its SimulationIndex
+	 * @return The SimulationIndex of the shape
+	 */
+	int32 AddShape(FTetherShape* Shape, FTetherCommonShapeData* Data);
+
+	/**
+	 * Add a copy of a shape and its per-shape data, owned by the simulation
+	 * @return The SimulationIndex of the copy
+	 */
+	int32 AddShapeCopy(const FTetherShape& Shape, const FTetherCommonShapeData& Data);
+
+	/**
+	 * Pull an added shape towards the DriveTarget of its inputs with a damped spring, re-evaluated every sub-tick
+	 * The shape is kept awake, it never settles while its target moves
+	 * @param Stiffness  Spring acceleration per unit of distance from the target
+	 * @param Damping    Acceleration opposing the shape's velocity, per unit of velocity
+	 */
+	void SetDrive(int32 ShapeIndex, float Stiffness, float Damping);
+
+	/** Exclude a pair of added shapes from collision detection */
+	void IgnoreCollision(FTetherShape* ShapeA, FTetherShape* ShapeB) { SharedData.IgnoreMatrix.Ignore(ShapeA, ShapeB); }
+
+	// Owner, any single thread
+
+	/** Queue an input, applied before the next sub-tick */
+	void EnqueueInput(FTetherPhysicsInput&& Input) { Inputs.Enqueue(MoveTemp(Input)); }
+
+	/**
+	 * The latest snapshot published by the subsystem, never blocks
+	 * @return nullptr if the simulation hasn't ticked yet
+	 */
+	const FTetherPhysicsOutput* ReadLatestOutput();
+
+	/**
+	 * Simulate on the calling thread instead of in the subsystem, only for simulations that aren't registered
+	 * Runs every sub-tick due this frame, then publishes the result for ReadLatestOutput()
+	 */
+	void Tick(float DeltaTime, ETetherPhysicsUpdateMode Mode = ETetherPhysicsUpdateMode::GameThread);
+
+	/** Ask the subsystem to stop simulating this, it is dropped on its next tick */
+	void Unregister() { bPendingRemoval = true; }
+	bool IsPendingRemoval() const { return bPendingRemoval.load(); }
+
+	// Subsystem, game thread
+
+	const TArray<FTetherShape*>& GetShapes() const { return Shapes; }
+
+	/** Re-resolve the collision filter of any shape whose type or ignore settings changed, called once per frame */
+	void RefreshCollisionFilters();
+
+	/** Consume every queued input and evaluate the drives, called before each sub-tick */
+	void ApplyInputs();
+
+	/** Record the transforms the next sub-tick starts from, so the owner can interpolate, called before each sub-tick */
+	void CapturePreviousTransforms();
+
+	/** Hand the current state to the owner */
+	void PublishOutput();
+
+	FTetherPhysicsUpdate PhysicsUpdate;
+
+protected:
+	friend class UTetherWorldSubsystem;
+
+	TArray<FTetherShape*> Shapes;
+
+	/** Shapes and per-shape data added by AddShapeCopy() */
+	TArray<TSharedPtr<FTetherShape>> OwnedShapes;
+	TArray<TUniquePtr<FTetherCommonShapeData>> OwnedShapeData;
+
+	/** Spring pulling a shape towards its target, see SetDrive() */
+	struct FDrive
+	{
+		float Stiffness = 0.f;
+		float Damping = 0.f;
+		TOptional<FVector> Target;
+
+		/** Force from the latest input, the spring is added on top */
+		FVector Force = FVector::ZeroVector;
+	};
+
+	/** Indexed by SimulationIndex, shapes without a drive have zero stiffness */
+	TArray<FDrive> Drives;
+
+	/** Transform of each shape before the latest sub-tick */
+	TArray<FTransform> PreviousShapeTransforms;
+
+	/** Inputs from the owner, consumed by the subsystem */
+	TQueue<FTetherPhysicsInput, EQueueMode::Spsc> Inputs;
+
+	/** Snapshots from the subsystem, consumed by the owner */
+	TTetherTripleBuffer<FTetherPhysicsOutput> Outputs;
+
+	std::atomic<bool> bPendingRemoval;
+};
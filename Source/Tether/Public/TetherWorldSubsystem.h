@@ -0,0 +1,56 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TetherWorldSubsystem.generated.h"
+
+struct FTetherSimulation;
+
+/**
+ * Simulates every registered FTetherSimulation in the world together
+ *
+ * Rather than each anim node running its own small simulation on whichever anim worker thread evaluates it, the
+ * subsystem sub-ticks all of them at once: every simulation is hashed, then every simulation is solved, and so on,
+ * each stage as a single wide ParallelFor. Per-simulation work stays tiny while total throughput scales with cores.
+ *
+ * Simulations keep their own frame rate and sub-tick budget; each batch contains the simulations that are due a
+ * sub-tick. Results are published to each simulation's owner once the frame's sub-ticks are complete, and are
+ * picked up by the anim nodes on their next evaluation.
+ */
+UCLASS()
+class TETHER_API UTetherWorldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UTetherWorldSubsystem* Get(const UWorld* World)
+	{
+		return World ? World->GetSubsystem<UTetherWorldSubsystem>() : nullptr;
+	}
+
+	/**
+	 * Start simulating. Thread-safe, the simulation is added on the subsystem's next tick
+	 * The simulation must be fully built beforehand, see FTetherSimulation
+	 */
+	void RegisterSimulation(const TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>& Simulation);
+
+	int32 GetNumSimulations() const { return Simulations.Num(); }
+
+protected:
+	/** Simulations being simulated, only accessed on the game thread */
+	TArray<TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>> Simulations;
+
+	/** Simulations registered since the last tick */
+	TArray<TSharedRef<FTetherSimulation, ESPMode::ThreadSafe>> PendingSimulations;
+
+	/** Guards PendingSimulations, registration can come from anim worker threads */
+	FCriticalSection PendingLock;
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "TetherThreadTypes.h"
 #include "ITetherPhysicsThreadInterface.generated.h"
 
 // This class does not need to be modified.
@@ -23,4 +24,13 @@ class TETHER_API ITetherPhysicsThreadInterface
 public:
 	virtual bool IsPhysicsSimulationPaused() const { return true; }
 	virtual void TickPhysics(float DeltaTime) PURE_VIRTUAL(,);
+
+	/** Called on the physics thread for each input queued by the game thread, before the next sub-tick */
+	virtual void ApplyPhysicsInput(const FTetherPhysicsInput& Input) {}
+
+	/**
+	 * Called on the physics thread after simulating, to fill the snapshot published to the game thread
+	 * Snapshots are recycled, so every field must be overwritten
+	 */
+	virtual void WritePhysicsOutput(FTetherPhysicsOutput& Output) const {}
 };
@@ -0,0 +1,94 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherThreadTypes.h"
+
+struct FTetherShape;
+struct FTetherCommonSharedData;
+struct FTetherBodyRange;
+
+/**
+ * A single simulation's sub-tick, for FTetherPhysicsPipeline::TickBatch()
+ */
+struct TETHER_API FTetherPipelineContext
+{
+	TArray<FTetherShape*>* Shapes = nullptr;
+	FTetherCommonSharedData* SharedData = nullptr;
+	FTransform Origin = FTransform::Identity;
+	float DeltaTime = 0.f;
+	double WorldTime = 0.0;
+};
+
+/**
+ * Runs a single sub-tick of the simulation: hashing, broad-phase, per-shape wake, linear and angular solvers, sleep,
+ * integration and narrow-phase
+ *
+ * In ETetherPhysicsUpdateMode::MultiThread the stages are launched as UE::Tasks with explicit prerequisites, and the
+ * per-shape stages are split into ParallelFor chunks of the body store so a single simulation with many bodies uses
+ * several workers. The linear and angular solvers write to separate arrays so they run concurrently.
+ * Every other mode runs the stages in order on the calling thread.
+ *
+ * After the per-body sleep decision, bodies are integrated island by island (see FTetherIslands); in MultiThread mode
+ * each island is a separate work item. Islands are rebuilt from the narrow-phase contacts at the end of the sub-tick.
+ *
+ * Per-body stages only visit the body store partition they can affect: waking visits asleep bodies, everything after it
+ * visits awake bodies and their islands. Kinematic bodies and islands that are entirely asleep cost nothing per sub-tick.
+ *
+ * TickBatch() sub-ticks many small simulations at once, running each stage for every simulation as one wide
+ * ParallelFor before moving to the next stage, so throughput scales with cores even when each simulation is tiny.
+ *
+ * Debug drawing is not part of the pipeline, it must happen on the game thread once the sub-tick has completed.
+ * Pair cache contact events are broadcast on the calling thread once every stage has completed.
+ * SharedData.Bodies must be populated and SharedData initialized before calling Tick().
+ */
+struct TETHER_API FTetherPhysicsPipeline
+{
+	/**
+	 * Simulate a single sub-tick, returning once every stage has completed
+	 *
+	 * @param Mode       Whether to run the stages as tasks or in order on the calling thread
+	 * @param Shapes     Every shape in the simulation, indexed by SimulationIndex
+	 * @param SharedData Shared solvers, inputs and outputs, including the body store
+	 * @param Origin     Origin for the hashing system
+	 * @param DeltaTime  The time step for this sub-tick
+	 * @param WorldTime  Current WorldTime appended by TimeTicks
+	 */
+	static void Tick(ETetherPhysicsUpdateMode Mode, TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData,
+		const FTransform& Origin, float DeltaTime, double WorldTime);
+
+	/**
+	 * Simulate a single sub-tick of every simulation in the batch, returning once every stage has completed
+	 * Each stage is run for all simulations in parallel, each simulation's stages run in order on one worker
+	 */
+	static void TickBatch(TConstArrayView<FTetherPipelineContext> Batch);
+
+protected:
+	static void TickSerial(TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData,
+		const FTransform& Origin, float DeltaTime, double WorldTime);
+
+	static void TickTasks(TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData,
+		const FTransform& Origin, float DeltaTime, double WorldTime);
+
+	/** Split the bodies into chunks of at least p.Tether.Pipeline.MinBodiesPerChunk and process them in parallel */
+	static void ParallelForBodies(int32 NumBodies, TFunctionRef<void(const FTetherBodyRange&)> Func);
+
+	// Stages
+
+	/** Narrow-phase inputs and initial islands, before any stage runs */
+	static void Prepare(FTetherCommonSharedData& SharedData);
+	static void Hash(TArray<FTetherShape*>& Shapes, FTetherCommonSharedData& SharedData, const FTransform& Origin,
+		float DeltaTime, double WorldTime);
+	static void BroadPhase(FTetherCommonSharedData& SharedData, float DeltaTime, double WorldTime);
+	/** Range is over the slots of the asleep partition rather than body indices */
+	static void Wake(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range, float DeltaTime, double WorldTime);
+	static void Gather(FTetherCommonSharedData& SharedData);
+	static void SolveLinear(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range, float DeltaTime, double WorldTime);
+	static void SolveAngular(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range, float DeltaTime, double WorldTime);
+	static void Sleep(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range, float DeltaTime, double WorldTime);
+	static void SolveIsland(FTetherCommonSharedData& SharedData, int32 Island, float DeltaTime, double WorldTime);
+	static void Integrate(FTetherCommonSharedData& SharedData, const FTetherBodyRange& Range, float DeltaTime, double WorldTime);
+	static void NarrowPhase(FTetherCommonSharedData& SharedData, float DeltaTime, double WorldTime);
+	static void BuildIslands(FTetherCommonSharedData& SharedData);
+};
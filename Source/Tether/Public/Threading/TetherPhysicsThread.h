@@ -5,6 +5,29 @@
 #include "CoreMinimal.h"
 #include "ITetherPhysicsThreadInterface.h"
 #include "TetherPhysicsUpdate.h"
+#include "TetherThreadTypes.h"
+#include "TetherTripleBuffer.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+/** Timing stats gathered by FTetherPhysicsRunnable, safe to read from any thread */
+struct TETHER_API FTetherPhysicsThreadStats
+{
+	/** Total number of sub-ticks simulated */
+	int64 TickCount = 0;
+
+	/** Number of times the thread woke later than LateTolerance past its deadline */
+	int64 LateTicks = 0;
+
+	/** Number of frames where simulating took longer than the time it simulated */
+	int64 Overruns = 0;
+
+	/** Number of frames that needed more sub-ticks than MaxSubsteps allowed */
+	int64 Overflows = 0;
+
+	/** The worst lateness observed, in seconds */
+	double MaxLateness = 0.0;
+};
 
 /**
  * Separate physics thread to optionally use
@@ -15,6 +38,16 @@
  * essential tasks. By giving your physics thread a lower priority, you allow the main thread to have preferential
  * access to the CPU. If your physics sim is more critical, consider increasing it.
  *
+ * The thread waits on an event until an absolute deadline, derived from the accumulator in FTetherPhysicsUpdate,
+ * rather than sleeping for a fixed interval, so sub-ticks land on the simulation rate without drifting. The final
+ * fraction of a millisecond is spent yielding because event waits only have millisecond granularity.
+ * Kick() wakes the thread early, e.g. when new input arrives or the simulation is unpaused. Input is applied as soon as
+ * the thread wakes, even if no sub-tick is due yet.
+ *
+ * State crosses threads without locks: the game thread queues inputs with EnqueueInput() and they are applied before
+ * the next sub-tick, while the physics thread publishes a snapshot through a triple buffer after simulating, which
+ * the game thread reads with ReadLatestOutput(). Neither thread ever waits on the other.
+ *
  * Owner must implement ITetherPhysicsThreadInterface
  */
 class TETHER_API FTetherPhysicsRunnable : public FRunnable
@@ -44,7 +77,40 @@ public:
 	/** Thread-safe way to check if the thread should stop */
 	bool ShouldStop() const;
 
+	/**
+	 * Wake the thread immediately instead of at its next deadline, so it can pick up new input, pause state or stop
+	 * requests. Sub-ticks still only occur once a full time tick has accumulated.
+	 */
+	void Kick();
+
+	/**
+	 * Queue an input for the physics thread, applied as soon as it wakes
+	 * Kicks the thread unless it has already been kicked for input it hasn't applied, so a burst only wakes it once
+	 * Only a single thread may enqueue inputs, typically the game thread
+	 */
+	void EnqueueInput(FTetherPhysicsInput&& Input);
+	void EnqueueInput(const FTetherPhysicsInput& Input);
+
+	/**
+	 * The latest snapshot published by the physics thread, never blocks
+	 * Only a single thread may read outputs, typically the game thread
+	 * @return nullptr if the physics thread hasn't published anything yet
+	 */
+	const FTetherPhysicsOutput* ReadLatestOutput();
+
+	/** Thread-safe snapshot of the timing stats */
+	FTetherPhysicsThreadStats GetStats() const;
+
 protected:
+	/**
+	 * Wait until the deadline has passed or the thread is kicked
+	 * @return True if kicked before the deadline
+	 */
+	bool WaitUntil(double Deadline) const;
+
+	/** Apply every queued input, on the physics thread */
+	void ApplyPendingInputs();
+
 	FTetherPhysicsRunnable(UObject* InThreadOwner = nullptr, float InSimulationFrameRate = 60.f, EThreadPriority ThreadPriority = TPri_BelowNormal, uint32 StackSize = 0);
 	virtual ~FTetherPhysicsRunnable() override;
 
@@ -54,11 +120,29 @@ protected:
 	/** The thread handle */
 	FRunnableThread* Thread;
 
-	/** Sync object to prevent data race conditions */
-	mutable FCriticalSection Mutex;
+	/** Signalled by Kick() and Stop() to wake the thread before its deadline */
+	FEvent* WakeEvent;
+
+	/** Inputs from the game thread, consumed by the physics thread */
+	TQueue<FTetherPhysicsInput, EQueueMode::Spsc> InputQueue;
+
+	/**
+	 * Set by the producer when it kicks the thread for new input, cleared by the physics thread before it drains the queue
+	 * TQueue::IsEmpty() reads the consumer's end of the queue, so the producer can't rely on it
+	 */
+	std::atomic<bool> bInputPending;
+
+	/** Snapshots from the physics thread, consumed by the game thread */
+	TTetherTripleBuffer<FTetherPhysicsOutput> OutputBuffer;
 
 	/** Whether the thread should stop */
-	bool bShouldStop;
+	std::atomic<bool> bShouldStop;
+
+	std::atomic<int64> StatTickCount;
+	std::atomic<int64> StatLateTicks;
+	std::atomic<int64> StatOverruns;
+	std::atomic<int64> StatOverflows;
+	std::atomic<double> StatMaxLateness;
 
 	FTetherPhysicsUpdate PhysicsUpdate;
 
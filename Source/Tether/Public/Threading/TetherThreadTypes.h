@@ -15,4 +15,58 @@ enum class ETetherPhysicsUpdateMode : uint8
 	GameThread			UMETA(ToolTip="Update in the main game thread. For simpler or non-vital simulations."),
 	SingleThread		UMETA(ToolTip="Update in a single custom thread. For improved determinism at a performance cost."),
 	MultiThread			UMETA(ToolTip="Update in a multi-threaded setup. For improved performance at the cost of determinism. May be more expensive than game thread update for simple simulations.")
-};
\ No newline at end of file
+};
+
+/**
+ * A single input sent from the game thread to the physics thread, applied before the next sub-tick
+ */
+struct TETHER_API FTetherPhysicsInput
+{
+	FTetherPhysicsInput(int32 InShapeIndex = INDEX_NONE)
+		: ShapeIndex(InShapeIndex)
+	{}
+
+	/** The SimulationIndex of the shape this input applies to */
+	int32 ShapeIndex;
+
+	/** If set, the shape is moved to this transform, e.g. from a bone */
+	TOptional<FTransform> KinematicTransform;
+
+	/** If set, the location the shape's drive pulls it towards, see FTetherSimulation::SetDrive() */
+	TOptional<FVector> DriveTarget;
+
+	/** Force to apply to the shape */
+	FVector Force = FVector::ZeroVector;
+
+	/** Torque to apply to the shape */
+	FVector Torque = FVector::ZeroVector;
+};
+
+/**
+ * Snapshot of the simulation published by the physics thread for the game thread to read
+ */
+struct TETHER_API FTetherPhysicsOutput
+{
+	/** Total number of sub-ticks simulated when this snapshot was published */
+	int64 TickCount = 0;
+
+	/** Total simulated time when this snapshot was published */
+	double SimulatedTime = 0.0;
+
+	/** How far presentation is between the previous and current simulated states */
+	float InterpolationAlpha = 1.f;
+
+	/** World transform of each shape, indexed by SimulationIndex */
+	TArray<FTransform> ShapeTransforms;
+
+	/** World transform of each shape before the latest sub-tick, indexed by SimulationIndex */
+	TArray<FTransform> PreviousShapeTransforms;
+
+	/** Blend the shape's previous and current transforms by InterpolationAlpha */
+	FTransform GetInterpolatedTransform(int32 ShapeIndex) const
+	{
+		FTransform Result;
+		Result.Blend(PreviousShapeTransforms[ShapeIndex], ShapeTransforms[ShapeIndex], InterpolationAlpha);
+		return Result;
+	}
+};
@@ -0,0 +1,79 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Lock-free triple buffer for handing the latest state from a single writer thread to a single reader thread
+ *
+ * The writer fills the write buffer and publishes it, the reader picks up whichever buffer was published most recently.
+ * Neither side ever blocks or waits on the other; if the writer publishes several times before the reader updates,
+ * the reader simply skips to the newest state.
+ *
+ * Buffers are recycled rather than reset, so containers inside T keep their allocations. The writer is expected to
+ * overwrite the entire write buffer before publishing it.
+ */
+template<typename T>
+class TTetherTripleBuffer
+{
+public:
+	TTetherTripleBuffer()
+		: SharedState(1)
+		, WriteIndex(0)
+		, ReadIndex(2)
+	{}
+
+	TTetherTripleBuffer(const TTetherTripleBuffer&) = delete;
+	TTetherTripleBuffer& operator=(const TTetherTripleBuffer&) = delete;
+
+	/** Writer only. The buffer to fill before calling Publish() */
+	T& GetWriteBuffer() { return Buffers[WriteIndex]; }
+
+	/** Writer only. Hand the write buffer to the reader and take the spare buffer for the next write */
+	void Publish()
+	{
+		const uint8 Previous = SharedState.exchange(WriteIndex | DirtyBit, std::memory_order_acq_rel);
+		WriteIndex = Previous & IndexMask;
+	}
+
+	/**
+	 * Reader only. Swap to the most recently published buffer, if there is one
+	 * @return True if the read buffer changed
+	 */
+	bool Update()
+	{
+		if ((SharedState.load(std::memory_order_acquire) & DirtyBit) == 0)
+		{
+			return false;
+		}
+
+		const uint8 Previous = SharedState.exchange(ReadIndex, std::memory_order_acq_rel);
+		ReadIndex = Previous & IndexMask;
+		bEverRead = true;
+		return true;
+	}
+
+	/** Reader only. The buffer most recently acquired by Update() */
+	const T& GetReadBuffer() const { return Buffers[ReadIndex]; }
+
+	/** Reader only. False until Update() has acquired a published buffer */
+	bool HasReadBuffer() const { return bEverRead; }
+
+private:
+	static constexpr uint8 IndexMask = 0x3;
+	static constexpr uint8 DirtyBit = 0x4;
+
+	T Buffers[3];
+
+	/** Index of the spare buffer between the writer and reader, plus DirtyBit when it holds unread data */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint8> SharedState;
+
+	/** Owned by the writer, kept on its own cache line to avoid false sharing with the reader */
+	alignas(PLATFORM_CACHE_LINE_SIZE) uint8 WriteIndex;
+
+	/** Owned by the reader */
+	alignas(PLATFORM_CACHE_LINE_SIZE) uint8 ReadIndex;
+	bool bEverRead = false;
+};
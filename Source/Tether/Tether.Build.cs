@@ -25,6 +25,7 @@ public class Tether : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"PhysicsCore",
 			}
 			);
 
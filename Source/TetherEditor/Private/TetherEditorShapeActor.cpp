@@ -47,6 +47,8 @@ FTetherShape* ATetherEditorShapeActor::GetTetherShape()
 	if (ShapeType == FTetherGameplayTags::Tether_Shape_BoundingSphere) { return &BoundingSphere; }
 	if (ShapeType == FTetherGameplayTags::Tether_Shape_Capsule) { return &Capsule; }
 	if (ShapeType == FTetherGameplayTags::Tether_Shape_Pipe) { return &Pipe; }
+	if (ShapeType == FTetherGameplayTags::Tether_Shape_ConvexHull) { return &ConvexHull; }
+	if (ShapeType == FTetherGameplayTags::Tether_Shape_Compound) { return &Compound; }
 	
 	return &AABB;
 }
@@ -69,5 +71,36 @@ bool ATetherEditorShapeActor::CanEditChange(const FProperty* InProperty) const
 	{
 		return ShapeType == FTetherGameplayTags::Tether_Shape_Capsule;
 	}
+	if (InProperty->GetFName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, ConvexHull)))
+	{
+		return ShapeType == FTetherGameplayTags::Tether_Shape_ConvexHull;
+	}
+	if (InProperty->GetFName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, Compound)))
+	{
+		return ShapeType == FTetherGameplayTags::Tether_Shape_Compound;
+	}
 	return Super::CanEditChange(InProperty);
 }
+
+#if WITH_EDITOR
+void ATetherEditorShapeActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Hulls and compound hierarchies are only built on construction and load
+	if (PropertyChangedEvent.GetMemberPropertyName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, ConvexHull)))
+	{
+		ConvexHull.BuildHull();
+		ConvexHull.UpdateBounds();
+	}
+	if (PropertyChangedEvent.GetMemberPropertyName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, Compound)))
+	{
+		for (FTetherShape_ConvexHull& Child : Compound.ConvexHulls)
+		{
+			Child.BuildHull();
+		}
+		Compound.BuildTree();
+		Compound.UpdateBounds();
+	}
+}
+#endif
@@ -8,14 +8,20 @@
 #include "TetherEditorShapeActor.h"
 #include "Physics/Collision/TetherCollisionDetectionBroadPhase.h"
 #include "Physics/Hashing/TetherHashingSpatial.h"
+#include "Physics/Solvers/Integration/TetherIntegrationSolver.h"
 #include "Physics/Solvers/Physics/TetherPhysicsSolverAngular.h"
 #include "Physics/Solvers/Physics/TetherPhysicsSolverLinear.h"
+#include "Physics/Handlers/TetherActivityStateHandler.h"
+#include "Physics/Collision/TetherCollisionDetectionNarrowPhase.h"
+#include "Threading/TetherPhysicsPipeline.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherEditorSubsystem)
 
 namespace FTether
 {
 	TAutoConsoleVariable<bool> CVarTetherMatchFramerateToSimRate(TEXT("p.Tether.MatchFramerateToSimRate"), true, TEXT("Set t.maxfps=SimulationFrameRate on BeginPlay so the render tick runs at the same rate as Tether, if it can manage to"));
+	TAutoConsoleVariable<bool> CVarTetherEditorMultiThread(TEXT("p.Tether.Editor.MultiThread"), false, TEXT("Simulate using the MultiThread pipeline, running each stage as a task and splitting per-shape stages across workers"));
+	TAutoConsoleVariable<bool> CVarTetherInterpolateShapeActors(TEXT("p.Tether.Editor.Interpolate"), false, TEXT("Blend editor shape actor transforms between the last two simulated states, for smooth presentation when rendering faster than SimulationFrameRate"));
 }
 
 void UTetherEditorSubsystem::OnWorldBeginPlay(UWorld& InWorld)
@@ -44,7 +50,7 @@ void UTetherEditorSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	
 	SharedData.SpatialHashingInput = DataAsset->SpatialHashingInput;
 
-	PhysicsUpdate = { DataAsset->SimulationFrameRate };
+	PhysicsUpdate = { DataAsset->SimulationFrameRate, DataAsset->MaxSubsteps, DataAsset->SubstepOverflow };
 
 	// Match render tick to physics tick, if the engine can keep up
 	if (FTether::CVarTetherMatchFramerateToSimRate.GetValueOnGameThread())
@@ -104,6 +110,7 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 	TArray<FTetherShape*> Shapes;	// Shapes grabbed from each editor shape actor
 	TArray<FVector> Origins;		// Averaged locations of all editor shape actors
 	TMap<const FTetherShape*, ATetherEditorShapeActor*> ShapeActorMap;
+	SharedData.Bodies.Reset();
 	for (ATetherEditorShapeActor* Actor : ShapeActors)
 	{
 		// Grab Shape
@@ -115,13 +122,22 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 			Shape->ToWorldSpace(Actor->GetActorTransform());
 		}
 
-		// Add to Shapes Array
-		Shapes.Add(Shape);
+		// Add to Shapes Array, the index is used to look up solver outputs
+		Shape->SimulationIndex = Shapes.Add(Shape);
+
+		// Resolve collision groups from the shape's tags, again only once its ignore settings change
+		if (!Shape->IsCollisionFilterResolved())
+		{
+			Shape->ResolveCollisionFilter();
+		}
 
 		// Cache and update solvers
 		FTetherCommonShapeData* const& SData = ShapeData.FindOrAdd(Shape, &Actor->ShapeData);
 		SData->InitializeShapeData();
 		SData->Solvers.UpdateSolvers();
+
+		// Add to the body store, in SimulationIndex order
+		SharedData.Bodies.Add(Shape, SData);
 		
 		// Cache transform for computing origin
 		Origins.Add(Shape->GetAppliedWorldTransform().GetLocation());
@@ -130,6 +146,27 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 		ShapeActorMap.Add(Shape, Actor);
 	}
 
+	// Explicit exclusions between actors, the matrix is only rebuilt if these or the shapes changed
+	TSet<FTetherShapePair> IgnoredPairs;
+	for (ATetherEditorShapeActor* Actor : ShapeActors)
+	{
+		for (const TWeakObjectPtr<ATetherEditorShapeActor>& IgnoredActor : Actor->IgnoredShapeActors)
+		{
+			if (IgnoredActor.IsValid() && IgnoredActor.Get() != Actor && ShapeActors.Contains(IgnoredActor.Get()))
+			{
+				IgnoredPairs.Add(FTetherShapePair(Actor->GetTetherShape(), IgnoredActor->GetTetherShape()));
+			}
+		}
+	}
+	SharedData.IgnoreMatrix.SetIgnoredPairs(MoveTemp(IgnoredPairs));
+
+	// Forget transforms cached for a different set of shapes, a destroyed actor's shape pointer may be reused
+	if (PreviousShapes != Shapes)
+	{
+		PreviousTransforms.Reset();
+		PreviousShapes = Shapes;
+	}
+
 	// Initialize shared data
 	SharedData.InitializeSharedData();
 
@@ -145,102 +182,63 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 
 	double WorldTime = GetWorld()->GetTimeSeconds();
 	
+	// Run the pipeline's stages as tasks, or serially on the game thread
+	const ETetherPhysicsUpdateMode UpdateMode = FTether::CVarTetherEditorMultiThread.GetValueOnGameThread() ?
+		ETetherPhysicsUpdateMode::MultiThread : ETetherPhysicsUpdateMode::GameThread;
+	
 	// Start the frame with the current DeltaTime
 	PhysicsUpdate.StartFrame(DeltaTime);
 
 	// Update at consistent framerate (default 60fps)
 	while (PhysicsUpdate.ShouldTick())
 	{
-		const float& TimeTick = PhysicsUpdate.TimeTick;
+		const float TimeTick = PhysicsUpdate.StepTime;
 
-		/* Spatial Hashing - Generate shape pairs based on proximity and efficiency ratings for priority */
+		// Cache the state prior to this sub-tick, presentation interpolates from it
+		for (const FTetherShape* Shape : Shapes)
+		{
+			PreviousTransforms.Add(Shape, Shape->GetAppliedWorldTransform());
+		}
+
+		/* Simulate - Hashing, Broad-Phase, Wake, Linear & Angular, Sleep, Integration, Narrow-Phase */
+		FTetherPhysicsPipeline::Tick(UpdateMode, Shapes, SharedData, Origin, TimeTick, WorldTime);
+
+		/* Debug Drawing - Only once the sub-tick is complete, because the pipeline may have run on worker threads */
 		if (SharedData.Solvers.CurrentHashingSystem)
 		{
-			SharedData.Solvers.CurrentHashingSystem->Solve(&Shapes, &SharedData.SpatialHashingInput,
-				&SharedData.SpatialHashingOutput, Origin, TimeTick, WorldTime);
-			
 			SharedData.Solvers.CurrentHashingSystem->DrawDebug(&Shapes, &SharedData.SpatialHashingInput,
 				&SharedData.SpatialHashingOutput, Origin, &DebugTextService.PendingDebugText, TimeTick, nullptr, GetWorld());
 		}
 		
-		/* Solve Broad-Phase Collision */
 		if (SharedData.Solvers.CurrentBroadPhaseCollisionDetection)
 		{
-			// Common optimization step where you quickly check if objects are close enough to potentially collide.
-			// It reduces the number of detailed collision checks needed in the narrow phase.
-			
-			SharedData.Solvers.CurrentBroadPhaseCollisionDetection->DetectCollision(&SharedData.BroadPhaseInput,
-				&SharedData.BroadPhaseOutput, SharedData.Solvers.CurrentCollisionDetectionHandler, TimeTick, WorldTime);
-			
 			SharedData.Solvers.CurrentBroadPhaseCollisionDetection->DrawDebug(&Shapes, &SharedData.BroadPhaseInput,
 				&SharedData.BroadPhaseOutput, &DebugTextService.PendingDebugText, TimeTick, nullptr, GetWorld());
 		}
 
-		// Update in preparation for Narrow-Phase
-		SharedData.NarrowPhaseInput.LinearOutputs.Reset();
-		SharedData.NarrowPhaseInput.AngularOutputs.Reset();
-
-		// Execute per-shape solvers
 		for (auto& ShapeItr : ShapeData)
 		{
 			FTetherShape* Shape = ShapeItr.Key;
 			FTetherCommonShapeData* Data = ShapeItr.Value;
 
-			/* Pre-Solve Activity State (Wake) */
-			
-			if (Data->Solvers.CurrentActivityStateHandler)
-			{
-				Data->Solvers.CurrentActivityStateHandler->PreSolveWake(Shape, &Data->ActivityInput,
-					&Data->LinearInput, &Data->AngularInput, TimeTick, WorldTime);
-			}
-			
-			/* Solve Linear & Angular Physics
-			 *	These steps calculate the velocities that will be applied to the object. By solving linear and angular
-			 *	physics first, you get the raw velocities that are then used in integration. */
-
 			if (Data->Solvers.CurrentLinearSolver)
 			{
-				Data->Solvers.CurrentLinearSolver->Solve(Shape, &Data->LinearInput, &Data->LinearOutput,
-					TimeTick, WorldTime);
-				
 				Data->Solvers.CurrentLinearSolver->DrawDebug(Shape, &Data->LinearInput, &Data->LinearOutput,
 					&DebugTextService.PendingDebugText, TimeTick, nullptr, GetWorld());
 			}
 
 			if (Data->Solvers.CurrentAngularSolver)
 			{
-				Data->Solvers.CurrentAngularSolver->Solve(Shape, &Data->AngularInput, &Data->AngularOutput,
-					TimeTick, WorldTime);
-				
 				Data->Solvers.CurrentAngularSolver->DrawDebug(Shape, &Data->AngularInput, &Data->AngularOutput,
 					&DebugTextService.PendingDebugText, TimeTick, nullptr, GetWorld());
 			}
 
-			/* Post-Solve Activity State (Sleep) */
 			if (Data->Solvers.CurrentActivityStateHandler)
 			{
-				Data->Solvers.CurrentActivityStateHandler->PostSolveSleep(Shape, &Data->ActivityInput,
-					&Data->LinearInput, &Data->AngularInput, &Data->LinearOutput,
-					&Data->AngularOutput, TimeTick, WorldTime);
-				
 				Data->Solvers.CurrentActivityStateHandler->DrawDebug(Shape, &Data->ActivityInput,
 					&DebugTextService.PendingDebugText, TimeTick, nullptr, GetWorld());
 			}
 
-			/* Solve Integration
-			 *	This part of the solver takes the results from the linear and angular solvers and updates the position
-			 *	and orientation of objects over time. It essentially integrates the calculated forces and torques to
-			 *	determine how an object should move in the next time step.
-			 */
-			if (Data->Solvers.CurrentIntegrationSolver)
-			{
-				Data->Solvers.CurrentIntegrationSolver->Solve(Shape, &Data->IntegrationInput, &Data->IntegrationOutput,
-					TimeTick, WorldTime);
-
-				// Update shape with new transform
-				Shape->ToWorldSpace(Data->IntegrationOutput.Transform);
-			}
-
 			// @TODO Test this and find a proper use-case
 			// // Record state of all objects post-integration for replay purposes
 			// if (Data->Solvers.CurrentReplaySystem)
@@ -248,27 +246,15 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 			// 	Data->Solvers.CurrentReplaySystem->RecordPhysicsState(Shape, &Data->RecordedData, WorldTime,
 			// 		&Data->LinearInput, &Data->AngularInput);
 			// }
-
-			// Update in preparation for Narrow-Phase
-			SharedData.NarrowPhaseInput.LinearOutputs.Add(Shape, &Data->LinearOutput);
-			SharedData.NarrowPhaseInput.AngularOutputs.Add(Shape, &Data->AngularOutput);
 		}
-		// ~Execute per-shape solvers
 
-		// @todo Solve Narrow-Phase Collision
 		if (SharedData.Solvers.CurrentNarrowPhaseCollisionDetection)
 		{
-			SharedData.Solvers.CurrentNarrowPhaseCollisionDetection->DetectCollision(&SharedData.NarrowPhaseInput,
-				&SharedData.NarrowPhaseOutput, SharedData.Solvers.CurrentCollisionDetectionHandler, TimeTick, WorldTime);
-			
 			SharedData.Solvers.CurrentNarrowPhaseCollisionDetection->DrawDebug(&Shapes,
 				&SharedData.NarrowPhaseInput, &SharedData.NarrowPhaseOutput,
 				&DebugTextService.PendingDebugText, TimeTick, nullptr, GetWorld());
 		}
 
-		// This step checks for actual collisions using detailed geometry after the object has been moved.
-		// It’s a more precise and computationally expensive check compared to the broad phase.
-
 		// @todo Solve Contact
 
 		// After detecting a collision, this step resolves it by adjusting the object's position and velocities. It
@@ -300,7 +286,9 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 
 	// Delta can be incredibly low, especially on first run, so that it never enters the while() loop
 	// Alternatively, we could do while() instead, but that means inconsistent ticks when the render delta is tiny
-	if (!PhysicsUpdate.bEverTicked)
+	// When interpolating, the presented state still advances between sub-ticks
+	const bool bInterpolate = FTether::CVarTetherInterpolateShapeActors.GetValueOnGameThread();
+	if (!PhysicsUpdate.bEverTicked && !bInterpolate)
 	{
 		return;
 	}
@@ -313,7 +301,8 @@ void UTetherEditorSubsystem::Tick(float DeltaTime)
 		if (ensure(IsValid(Actor)))
 		{
 			const FTransform& Transform = Shape->GetAppliedWorldTransform();
-			Actor->SetActorTransform(Transform);
+			const FTransform* PreviousTransform = bInterpolate ? PreviousTransforms.Find(Shape) : nullptr;
+			Actor->SetActorTransform(PreviousTransform ? PhysicsUpdate.Interpolate(*PreviousTransform, Transform) : Transform);
 		}
 	}
 
@@ -11,6 +11,8 @@
 #include "Shapes/TetherShape_BoundingSphere.h"
 #include "Shapes/TetherShape_Capsule.h"
 #include "Shapes/TetherShape_Pipe.h"
+#include "Shapes/TetherShape_ConvexHull.h"
+#include "Shapes/TetherShape_Compound.h"
 #include "TetherEditorShapeActor.generated.h"
 
 /**
@@ -40,10 +42,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(DisplayName="Pipe"))
 	FTetherShape_Pipe Pipe;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(DisplayName="Convex Hull"))
+	FTetherShape_ConvexHull ConvexHull;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(DisplayName="Compound"))
+	FTetherShape_Compound Compound;
+
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
 	FTetherCommonShapeData ShapeData;
 
+	/** Shape actors this one never collides with, excluded through the collision ignore matrix */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	TArray<TWeakObjectPtr<ATetherEditorShapeActor>> IgnoredShapeActors;
+
 public:
 	ATetherEditorShapeActor(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
@@ -55,4 +67,8 @@ public:
 public:
 	virtual bool CanEditChange(const FProperty* InProperty) const override;
 
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 };
@@ -44,6 +44,12 @@ protected:
 
 	TMap<FTetherShape*, FTetherCommonShapeData*> ShapeData;
 
+	/** Each shape's world transform before the most recent sub-tick, used to interpolate presentation */
+	TMap<const FTetherShape*, FTransform> PreviousTransforms;
+
+	/** Shapes simulated on the previous tick, PreviousTransforms is reset when they change */
+	TArray<FTetherShape*> PreviousShapes;
+
 public:
 	UPROPERTY(Transient, DuplicateTransient)
 	TArray<ATetherEditorShapeActor*> ShapeActors;
@@ -0,0 +1,263 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Collision/TetherCollisionBatch.h"
+
+namespace FTetherCollisionBatchPrivate
+{
+	static constexpr float SmallNumber = KINDA_SMALL_NUMBER;
+
+	FORCEINLINE VectorRegister4Float Dot3(const VectorRegister4Float& AX, const VectorRegister4Float& AY,
+		const VectorRegister4Float& AZ, const VectorRegister4Float& BX, const VectorRegister4Float& BY,
+		const VectorRegister4Float& BZ)
+	{
+		return VectorMultiplyAdd(AZ, BZ, VectorMultiplyAdd(AY, BY, VectorMultiply(AX, BX)));
+	}
+
+	FORCEINLINE VectorRegister4Float Clamp01(const VectorRegister4Float& V)
+	{
+		return VectorMin(VectorMax(V, VectorZeroFloat()), VectorOneFloat());
+	}
+
+	/** Divide that yields zero wherever the denominator is near zero */
+	FORCEINLINE VectorRegister4Float SafeDivide(const VectorRegister4Float& Num, const VectorRegister4Float& Den)
+	{
+		const VectorRegister4Float Epsilon = VectorSetFloat1(SmallNumber);
+		const VectorRegister4Float Valid = VectorCompareGT(Den, Epsilon);
+		return VectorSelect(Valid, VectorDivide(Num, VectorMax(Den, Epsilon)), VectorZeroFloat());
+	}
+
+	/** Shared tail of every kernel, tests overlap and writes the results for four lanes */
+	FORCEINLINE void StoreResults(FTetherNarrowPhaseBatch& Batch, int32 Lane, const VectorRegister4Float& DistSq,
+		const VectorRegister4Float& RadiusSum, const VectorRegister4Float& CX, const VectorRegister4Float& CY,
+		const VectorRegister4Float& CZ)
+	{
+		const VectorRegister4Float Hit = VectorCompareLE(DistSq, VectorMultiply(RadiusSum, RadiusSum));
+		Batch.HitMasks[Lane >> 2] = VectorMaskBits(Hit);
+		VectorStore(VectorSubtract(RadiusSum, VectorSqrt(DistSq)), &Batch.PenetrationDepth[Lane]);
+		VectorStore(CX, &Batch.ContactX[Lane]);
+		VectorStore(CY, &Batch.ContactY[Lane]);
+		VectorStore(CZ, &Batch.ContactZ[Lane]);
+	}
+}
+
+void FTetherNarrowPhaseBatch::Reset()
+{
+	PairIndices.Reset();
+	Origins.Reset();
+}
+
+int32 FTetherNarrowPhaseBatch::PrepareResults(const TArrayView<TArray<float>*>& Lanes)
+{
+	const int32 Padded = Align(Num(), 4);
+	for (TArray<float>* Lane : Lanes)
+	{
+		// Padding lanes are zero, their results are never read
+		Lane->SetNumZeroed(Padded);
+	}
+
+	HitMasks.SetNumUninitialized(Padded / 4);
+	ContactX.SetNumUninitialized(Padded);
+	ContactY.SetNumUninitialized(Padded);
+	ContactZ.SetNumUninitialized(Padded);
+	PenetrationDepth.SetNumUninitialized(Padded);
+	return Padded;
+}
+
+void FTetherSphereSphereBatch::Add(int32 PairIndex, const FVector& CenterA, float RadiusA, const FVector& CenterB,
+	float RadiusB)
+{
+	const FVector3f Offset = FVector3f(CenterB - CenterA);
+	PairIndices.Add(PairIndex);
+	Origins.Add(CenterA);
+	BX.Add(Offset.X);
+	BY.Add(Offset.Y);
+	BZ.Add(Offset.Z);
+	RadiusSum.Add(RadiusA + RadiusB);
+}
+
+void FTetherSphereSphereBatch::Reset()
+{
+	FTetherNarrowPhaseBatch::Reset();
+	BX.Reset();
+	BY.Reset();
+	BZ.Reset();
+	RadiusSum.Reset();
+}
+
+void FTetherSphereSphereBatch::Solve()
+{
+	using namespace FTetherCollisionBatchPrivate;
+
+	TArray<float>* Lanes[] = { &BX, &BY, &BZ, &RadiusSum };
+	const int32 Padded = PrepareResults(Lanes);
+
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	for (int32 i = 0; i < Padded; i += 4)
+	{
+		const VectorRegister4Float X = VectorLoad(&BX[i]);
+		const VectorRegister4Float Y = VectorLoad(&BY[i]);
+		const VectorRegister4Float Z = VectorLoad(&BZ[i]);
+
+		// Contact at the midpoint between the centers
+		StoreResults(*this, i, Dot3(X, Y, Z, X, Y, Z), VectorLoad(&RadiusSum[i]),
+			VectorMultiply(X, Half), VectorMultiply(Y, Half), VectorMultiply(Z, Half));
+	}
+}
+
+void FTetherSphereCapsuleBatch::Add(int32 PairIndex, const FVector& SphereCenter, float SphereRadius,
+	const FVector& CapsuleStart, const FVector& CapsuleEnd, float CapsuleRadius)
+{
+	const FVector3f Start = FVector3f(CapsuleStart - SphereCenter);
+	const FVector3f Segment = FVector3f(CapsuleEnd - CapsuleStart);
+	PairIndices.Add(PairIndex);
+	Origins.Add(SphereCenter);
+	PX.Add(Start.X);
+	PY.Add(Start.Y);
+	PZ.Add(Start.Z);
+	DX.Add(Segment.X);
+	DY.Add(Segment.Y);
+	DZ.Add(Segment.Z);
+	RadiusSum.Add(SphereRadius + CapsuleRadius);
+}
+
+void FTetherSphereCapsuleBatch::Reset()
+{
+	FTetherNarrowPhaseBatch::Reset();
+	PX.Reset();
+	PY.Reset();
+	PZ.Reset();
+	DX.Reset();
+	DY.Reset();
+	DZ.Reset();
+	RadiusSum.Reset();
+}
+
+void FTetherSphereCapsuleBatch::Solve()
+{
+	using namespace FTetherCollisionBatchPrivate;
+
+	TArray<float>* Lanes[] = { &PX, &PY, &PZ, &DX, &DY, &DZ, &RadiusSum };
+	const int32 Padded = PrepareResults(Lanes);
+
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	for (int32 i = 0; i < Padded; i += 4)
+	{
+		const VectorRegister4Float SX = VectorLoad(&PX[i]);
+		const VectorRegister4Float SY = VectorLoad(&PY[i]);
+		const VectorRegister4Float SZ = VectorLoad(&PZ[i]);
+		const VectorRegister4Float VX = VectorLoad(&DX[i]);
+		const VectorRegister4Float VY = VectorLoad(&DY[i]);
+		const VectorRegister4Float VZ = VectorLoad(&DZ[i]);
+
+		// Sphere center is the origin, so project -Start onto the segment
+		const VectorRegister4Float T = Clamp01(SafeDivide(VectorNegate(Dot3(SX, SY, SZ, VX, VY, VZ)),
+			Dot3(VX, VY, VZ, VX, VY, VZ)));
+
+		// Closest point on the segment
+		const VectorRegister4Float CX = VectorMultiplyAdd(VX, T, SX);
+		const VectorRegister4Float CY = VectorMultiplyAdd(VY, T, SY);
+		const VectorRegister4Float CZ = VectorMultiplyAdd(VZ, T, SZ);
+
+		// Contact at the midpoint between the sphere center and the closest point
+		StoreResults(*this, i, Dot3(CX, CY, CZ, CX, CY, CZ), VectorLoad(&RadiusSum[i]),
+			VectorMultiply(CX, Half), VectorMultiply(CY, Half), VectorMultiply(CZ, Half));
+	}
+}
+
+void FTetherCapsuleCapsuleBatch::Add(int32 PairIndex, const FVector& CenterA, const FVector& StartA,
+	const FVector& EndA, float RadiusA, const FVector& StartB, const FVector& EndB, float RadiusB)
+{
+	const FVector3f LocalStartA = FVector3f(StartA - CenterA);
+	const FVector3f SegmentA = FVector3f(EndA - StartA);
+	const FVector3f LocalStartB = FVector3f(StartB - CenterA);
+	const FVector3f SegmentB = FVector3f(EndB - StartB);
+	PairIndices.Add(PairIndex);
+	Origins.Add(CenterA);
+	APX.Add(LocalStartA.X);
+	APY.Add(LocalStartA.Y);
+	APZ.Add(LocalStartA.Z);
+	ADX.Add(SegmentA.X);
+	ADY.Add(SegmentA.Y);
+	ADZ.Add(SegmentA.Z);
+	BPX.Add(LocalStartB.X);
+	BPY.Add(LocalStartB.Y);
+	BPZ.Add(LocalStartB.Z);
+	BDX.Add(SegmentB.X);
+	BDY.Add(SegmentB.Y);
+	BDZ.Add(SegmentB.Z);
+	RadiusSum.Add(RadiusA + RadiusB);
+}
+
+void FTetherCapsuleCapsuleBatch::Reset()
+{
+	FTetherNarrowPhaseBatch::Reset();
+	for (TArray<float>* Lane : { &APX, &APY, &APZ, &ADX, &ADY, &ADZ, &BPX, &BPY, &BPZ, &BDX, &BDY, &BDZ, &RadiusSum })
+	{
+		Lane->Reset();
+	}
+}
+
+void FTetherCapsuleCapsuleBatch::Solve()
+{
+	using namespace FTetherCollisionBatchPrivate;
+
+	TArray<float>* Lanes[] = { &APX, &APY, &APZ, &ADX, &ADY, &ADZ, &BPX, &BPY, &BPZ, &BDX, &BDY, &BDZ, &RadiusSum };
+	const int32 Padded = PrepareResults(Lanes);
+
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float Epsilon = VectorSetFloat1(SmallNumber);
+	for (int32 i = 0; i < Padded; i += 4)
+	{
+		const VectorRegister4Float P1X = VectorLoad(&APX[i]);
+		const VectorRegister4Float P1Y = VectorLoad(&APY[i]);
+		const VectorRegister4Float P1Z = VectorLoad(&APZ[i]);
+		const VectorRegister4Float D1X = VectorLoad(&ADX[i]);
+		const VectorRegister4Float D1Y = VectorLoad(&ADY[i]);
+		const VectorRegister4Float D1Z = VectorLoad(&ADZ[i]);
+		const VectorRegister4Float P2X = VectorLoad(&BPX[i]);
+		const VectorRegister4Float P2Y = VectorLoad(&BPY[i]);
+		const VectorRegister4Float P2Z = VectorLoad(&BPZ[i]);
+		const VectorRegister4Float D2X = VectorLoad(&BDX[i]);
+		const VectorRegister4Float D2Y = VectorLoad(&BDY[i]);
+		const VectorRegister4Float D2Z = VectorLoad(&BDZ[i]);
+
+		// Closest points between segments, branchless form of Ericson's ClosestPtSegmentSegment
+		const VectorRegister4Float RX = VectorSubtract(P1X, P2X);
+		const VectorRegister4Float RY = VectorSubtract(P1Y, P2Y);
+		const VectorRegister4Float RZ = VectorSubtract(P1Z, P2Z);
+
+		const VectorRegister4Float A = Dot3(D1X, D1Y, D1Z, D1X, D1Y, D1Z);
+		const VectorRegister4Float B = Dot3(D1X, D1Y, D1Z, D2X, D2Y, D2Z);
+		const VectorRegister4Float C = Dot3(D1X, D1Y, D1Z, RX, RY, RZ);
+		const VectorRegister4Float E = Dot3(D2X, D2Y, D2Z, D2X, D2Y, D2Z);
+		const VectorRegister4Float F = Dot3(D2X, D2Y, D2Z, RX, RY, RZ);
+
+		// Parallel segments yield S = 0, and the clamped T below picks the nearest point
+		const VectorRegister4Float Denom = VectorSubtract(VectorMultiply(A, E), VectorMultiply(B, B));
+		VectorRegister4Float S = Clamp01(SafeDivide(VectorSubtract(VectorMultiply(B, F), VectorMultiply(C, E)), Denom));
+
+		// Degenerate segment B (a sphere) keeps T at zero
+		const VectorRegister4Float T = Clamp01(SafeDivide(VectorMultiplyAdd(B, S, F), E));
+
+		// Recompute S for the clamped T, degenerate segment A keeps S at zero
+		S = VectorSelect(VectorCompareGT(A, Epsilon),
+			Clamp01(SafeDivide(VectorSubtract(VectorMultiply(B, T), C), A)), VectorZeroFloat());
+
+		const VectorRegister4Float C1X = VectorMultiplyAdd(D1X, S, P1X);
+		const VectorRegister4Float C1Y = VectorMultiplyAdd(D1Y, S, P1Y);
+		const VectorRegister4Float C1Z = VectorMultiplyAdd(D1Z, S, P1Z);
+		const VectorRegister4Float C2X = VectorMultiplyAdd(D2X, T, P2X);
+		const VectorRegister4Float C2Y = VectorMultiplyAdd(D2Y, T, P2Y);
+		const VectorRegister4Float C2Z = VectorMultiplyAdd(D2Z, T, P2Z);
+
+		const VectorRegister4Float DeltaX = VectorSubtract(C2X, C1X);
+		const VectorRegister4Float DeltaY = VectorSubtract(C2Y, C1Y);
+		const VectorRegister4Float DeltaZ = VectorSubtract(C2Z, C1Z);
+
+		// Contact at the midpoint between the closest points
+		StoreResults(*this, i, Dot3(DeltaX, DeltaY, DeltaZ, DeltaX, DeltaY, DeltaZ), VectorLoad(&RadiusSum[i]),
+			VectorMultiply(VectorAdd(C1X, C2X), Half), VectorMultiply(VectorAdd(C1Y, C2Y), Half),
+			VectorMultiply(VectorAdd(C1Z, C2Z), Half));
+	}
+}
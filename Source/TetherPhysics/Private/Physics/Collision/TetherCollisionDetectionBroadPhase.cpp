@@ -6,7 +6,7 @@
 #include "TetherIO.h"
 #include "TetherStatics.h"
 #include "Physics/Collision/TetherCollisionDetectionHandler.h"
-#include "Shapes/TetherShape_AxisAlignedBoundingBox.h"
+#include "System/TetherDrawing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherCollisionDetectionBroadPhase)
 
@@ -27,12 +27,18 @@ void UTetherCollisionDetectionBroadPhase::DetectCollision(const FTetherIO* Input
 
 	// Clear the output before starting
 	Output->CollisionPairings.Reset();
+	Output->PairCache.BeginBroadPhase();
 
 	// Iterate through each potential collision pair
 	for (const FTetherShapePair& Pair : *Input->PotentialCollisionPairings)
 	{
 		// Perform broad-phase collision checks between ShapeA and ShapeB
-		if (CollisionDetectionHandler->CheckBroadCollision(Pair.ShapeA, Pair.ShapeB))
+		const bool bOverlapping = CollisionDetectionHandler->CheckBroadCollision(Pair.ShapeA, Pair.ShapeB);
+
+		// Carry the pair forward in the cache
+		Output->PairCache.AddBroadPhaseResult(Pair, bOverlapping);
+		
+		if (bOverlapping)
 		{
 			// If a collision is detected, add it to the output
 			Output->CollisionPairings.Add(Pair);
@@ -49,6 +55,9 @@ void UTetherCollisionDetectionBroadPhase::DetectCollision(const FTetherIO* Input
 			}
 		}
 	}
+
+	// End any pairs that are no longer overlapping
+	Output->PairCache.EndBroadPhase();
 }
 
 void UTetherCollisionDetectionBroadPhase::DrawDebug(const TArray<FTetherShape*>* Shapes, const FTetherIO* InputData,
@@ -66,37 +75,15 @@ void UTetherCollisionDetectionBroadPhase::DrawDebug(const TArray<FTetherShape*>*
 		return;
 	}
 	
-	const auto* Input = InputData->GetDataIO<FBroadPhaseInput>();
 	const auto* Output = OutputData->GetDataIO<FBroadPhaseOutput>();
 
-	// Draw bounding boxes - this is O(n^2) at least, but it isn't in shipping builds
+	// Draw bounding boxes
 	for (const FTetherShape* Shape : *Shapes)
 	{
-		bool bFoundInCollisionPairings = false;
-		bool bFoundInPotentialCollisionPairings = false;
-
-		// Check in Output->CollisionPairings - did it overlap something?
-		for (const FTetherShapePair& Pair : Output->CollisionPairings)
-		{
-			if (Pair.ContainsShape(Shape))
-			{
-				bFoundInCollisionPairings = true;
-				break;  // Stop searching once found
-			}
-		}
-
-		// Check in Input->PotentialCollisionPairings if it wasn't found in Output->CollisionPairings
-		if (!bFoundInCollisionPairings)
-		{
-			for (const FTetherShapePair& Pair : *Input->PotentialCollisionPairings)
-			{
-				if (Pair.ContainsShape(Shape))
-				{
-					bFoundInPotentialCollisionPairings = true;
-					break;  // Stop searching once found
-				}
-			}
-		}
+		// Did it overlap something, or was it at least tested?
+		const bool bFoundInCollisionPairings = Output->PairCache.BroadPhaseOverlappingShapes.Contains(Shape);
+		const bool bFoundInPotentialCollisionPairings = !bFoundInCollisionPairings &&
+			Output->PairCache.BroadPhaseTestedShapes.Contains(Shape);
 
 		// Now decide which color to draw it as based on where the shape was found
 		FColor DebugColor;
@@ -116,8 +103,8 @@ void UTetherCollisionDetectionBroadPhase::DrawDebug(const TArray<FTetherShape*>*
 			DebugColor = NoTestColor;
 		}
 		
-		FTetherShape_AxisAlignedBoundingBox AABB = Shape->GetTetherShapeObject()->GetBoundingBox(*Shape);
-		AABB.DrawDebug(World, Proxy, DebugColor, false, LifeTime, 1.f);
+		const FTetherShapeBounds& Bounds = Shape->GetBounds();
+		UTetherDrawing::DrawBox(World, Proxy, Bounds.Center, Bounds.GetExtents(), FQuat::Identity, DebugColor, false, LifeTime, 1.f);
 	}
 #endif
 }
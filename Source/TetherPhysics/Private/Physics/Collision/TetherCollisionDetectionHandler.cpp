@@ -4,10 +4,11 @@
 #include "Physics/Collision/TetherCollisionDetectionHandler.h"
 
 #include "TetherIO.h"
-#include "Shapes/TetherShapeCaster.h"
+#include "Physics/Collision/TetherGJK.h"
 #include "Shapes/TetherShape_AxisAlignedBoundingBox.h"
 #include "Shapes/TetherShape_BoundingSphere.h"
 #include "Shapes/TetherShape_Capsule.h"
+#include "Shapes/TetherShape_Compound.h"
 #include "Shapes/TetherShape_OrientedBoundingBox.h"
 #include "Shapes/TetherShape_Pipe.h"
 
@@ -22,306 +23,507 @@ FVector UTetherCollisionDetectionHandler::ClampVector(const FVector& InVector, c
 	return Result;
 }
 
-bool UTetherCollisionDetectionHandler::CheckBroadCollision(const FTetherShape* ShapeA, const FTetherShape* ShapeB) const
+namespace FTetherPipePrivate
 {
-	if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
+	/** Alternating closest-point projections settle the radial and height offsets within a few iterations */
+	static constexpr int32 MaxProjections = 4;
+
+	/** Newton iterations on the arc angle, each one either a Newton step or a bisection of the bracket */
+	static constexpr int32 MaxNewtonIterations = 8;
+
+	/** Half the arc searched by the Newton refinement, either side of the angle the projections stopped at */
+	static constexpr float NewtonWindow = UE_PI * 0.25f;
+
+	static constexpr float AngleTolerance = 1e-4f;
+
+	/** The closest points on the pipe's cross-section at a given angle and on the other shape */
+	struct FArcSample
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Broad_AABB_AABB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Broad_AABB_BoundingSphere(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Broad_AABB_OBB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Broad_AABB_Capsule(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+		float Angle = 0.f;
+		float DistanceSquared = 0.f;
+
+		/** Derivative of DistanceSquared with respect to Angle */
+		float Slope = 0.f;
+
+		/** Second derivative of DistanceSquared with respect to Angle, holding the point on the other shape fixed */
+		float Curvature = 0.f;
+
+		FVector PointOnPipe = FVector::ZeroVector;
+		FVector PointOnOther = FVector::ZeroVector;
+		bool bOverlap = false;
+	};
+
+	template<typename TProjectOnOther>
+	FArcSample SampleArc(const FTetherPipeGeometry& Pipe, float Angle, const FVector& PointOnOther,
+		const TProjectOnOther& ProjectOnOther)
+	{
+		FArcSample Sample;
+		Sample.Angle = Angle;
+		Sample.PointOnOther = PointOnOther;
+
+		// The cross-section and the other shape are both convex, two projections between them are enough to
+		// settle the radial and height offsets for this angle
+		float Radial = 0.f;
+		for (int32 Projection = 0; Projection < 2; Projection++)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Broad_AABB_Pipe(A, B);
+			Sample.PointOnPipe = Pipe.GetClosestPointOnSection(Sample.PointOnOther, Angle, Radial);
+			Sample.PointOnOther = ProjectOnOther(Sample.PointOnPipe, Sample.bOverlap);
+			if (Sample.bOverlap)
+			{
+				Sample.PointOnOther = Sample.PointOnPipe;
+				return Sample;
+			}
 		}
+
+		const FVector Delta = Sample.PointOnPipe - Sample.PointOnOther;
+		Sample.DistanceSquared = Delta.SizeSquared();
+		Sample.bOverlap = Sample.DistanceSquared <= FMath::Square(KINDA_SMALL_NUMBER);
+
+		// The point on the pipe moves along the tangent, and curves back towards the axis, as the angle changes
+		Sample.Slope = 2.f * Radial * (Delta | Pipe.GetTangentDirection(Angle));
+		Sample.Curvature = 2.f * Radial * (Radial - (Delta | Pipe.GetRadialDirection(Angle)));
+		return Sample;
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
+
+	/**
+	 * Refine the closest points along the arc, where alternating projections creep towards the answer slowly
+	 * Newton steps on the derivative of the squared distance with respect to the arc angle, bisecting the bracket
+	 * around its root whenever a step would leave it. If the root isn't bracketed within the window, the distance
+	 * is smallest at one end of it and that end is kept. The closest pair seen is returned if the iterations run out.
+	 * @return True if the shapes overlap at OutPointOnPipe
+	 */
+	template<typename TProjectOnOther>
+	bool RefineArcAngle(const FTetherPipeGeometry& Pipe, const TProjectOnOther& ProjectOnOther,
+		FVector& OutPointOnPipe, FVector& OutPointOnOther)
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
+		const float Start = Pipe.GetArcAngle(OutPointOnPipe);
+		float LowAngle = Start - NewtonWindow;
+		float HighAngle = Start + NewtonWindow;
+		if (!Pipe.IsFullCircle())
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Broad_OBB_AABB(A, B);
+			LowAngle = FMath::Max(LowAngle, 0.f);
+			HighAngle = FMath::Min(HighAngle, Pipe.ArcRadians);
 		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
+
+		FArcSample Best = SampleArc(Pipe, FMath::Clamp(Start, LowAngle, HighAngle), OutPointOnOther, ProjectOnOther);
+		const auto Consider = [&Best](const FArcSample& Sample)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Broad_OBB_BoundingSphere(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
+			if (Sample.bOverlap || Sample.DistanceSquared < Best.DistanceSquared)
+			{
+				Best = Sample;
+			}
+			return Sample.bOverlap;
+		};
+
+		const auto Finish = [&Best, &OutPointOnPipe, &OutPointOnOther]()
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Broad_OBB_OBB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
+			OutPointOnPipe = Best.PointOnPipe;
+			OutPointOnOther = Best.PointOnOther;
+			return Best.bOverlap;
+		};
+
+		FArcSample Low = SampleArc(Pipe, LowAngle, Best.PointOnOther, ProjectOnOther);
+		FArcSample High = SampleArc(Pipe, HighAngle, Best.PointOnOther, ProjectOnOther);
+		if (Best.bOverlap || Consider(Low) || Consider(High) || Low.Slope >= 0.f || High.Slope <= 0.f)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Broad_OBB_Capsule(A, B);
+			// Overlapping, or the distance is smallest at one end of the window
+			return Finish();
 		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+
+		FArcSample Current = Best;
+		for (int32 Iteration = 0; Iteration < MaxNewtonIterations; Iteration++)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Broad_OBB_Pipe(A, B);
+			// Narrow the bracket around the root of the slope
+			if (Current.Angle > Low.Angle && Current.Angle < High.Angle)
+			{
+				(Current.Slope < 0.f ? Low : High) = Current;
+			}
+
+			// Newton step, unless it would leave the bracket or the distance isn't convex here
+			float Next = (Low.Angle + High.Angle) * 0.5f;
+			if (Current.Curvature > UE_SMALL_NUMBER)
+			{
+				const float Step = Current.Angle - Current.Slope / Current.Curvature;
+				if (Step > Low.Angle && Step < High.Angle)
+				{
+					Next = Step;
+				}
+			}
+
+			if (FMath::Abs(Next - Current.Angle) <= AngleTolerance || High.Angle - Low.Angle <= AngleTolerance)
+			{
+				break;
+			}
+
+			Current = SampleArc(Pipe, Next, Current.PointOnOther, ProjectOnOther);
+			if (Consider(Current))
+			{
+				break;
+			}
 		}
+		return Finish();
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
+
+	/**
+	 * Alternate closest-point projections between the pipe and another shape, starting from the seed projected onto
+	 * the other shape, then refine along the arc if they haven't settled. A point that lands inside either shape
+	 * means they overlap at that point.
+	 * @param ProjectOnOther Closest point on the other shape, and whether the point was already inside it
+	 * @return True if the shapes overlap at OutPointOnPipe
+	 */
+	template<typename TProjectOnOther>
+	bool FindClosestPoints(const FTetherPipeGeometry& Pipe, const FVector& Seed, const TProjectOnOther& ProjectOnOther,
+		FVector& OutPointOnPipe, FVector& OutPointOnOther)
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Broad_BoundingSphere_AABB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Broad_BoundingSphere_BoundingSphere(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Broad_BoundingSphere_OBB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Broad_BoundingSphere_Capsule(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+		bool bInside = false;
+		OutPointOnOther = ProjectOnOther(Seed, bInside);
+		OutPointOnPipe = OutPointOnOther;
+		
+		for (int32 Iteration = 0; Iteration < MaxProjections; Iteration++)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Broad_BoundingSphere_Pipe(A, B);
+			OutPointOnPipe = Pipe.GetClosestPoint(OutPointOnOther, bInside);
+			if (bInside)
+			{
+				return true;
+			}
+
+			const FVector Previous = OutPointOnOther;
+			OutPointOnOther = ProjectOnOther(OutPointOnPipe, bInside);
+			if (bInside)
+			{
+				return true;
+			}
+
+			if (OutPointOnOther.Equals(Previous, KINDA_SMALL_NUMBER))
+			{
+				return false;
+			}
 		}
+
+		// Still moving when the projections ran out, typically creeping around the arc
+		return RefineArcAngle(Pipe, ProjectOnOther, OutPointOnPipe, OutPointOnOther);
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
+
+	/** Contact between the pipe and a sphere, given the closest point on the pipe to the sphere's center */
+	static bool ResolveSphere(const FTetherPipeGeometry& Pipe, const FVector& PointOnPipe, const FVector& Center, float Radius,
+		bool bCenterInside, FNarrowPhaseCollision& Output)
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Broad_Capsule_AABB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Broad_Capsule_BoundingSphere(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Broad_Capsule_OBB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
+		if (bCenterInside)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Broad_Capsule_Capsule(A, B);
+			// The center is inside the pipe, push it out through the nearest face
+			FVector Normal;
+			Output.PenetrationDepth = Pipe.GetPenetration(Center, Normal) + Radius;
+			Output.ContactNormal = Normal;
+			Output.ContactPoint = Center;
+			return true;
 		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+
+		const float DistanceSquared = FVector::DistSquared(PointOnPipe, Center);
+		if (DistanceSquared > FMath::Square(Radius))
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Broad_Capsule_Pipe(A, B);
+			return false;
 		}
+
+		const float Distance = FMath::Sqrt(DistanceSquared);
+		Output.ContactPoint = PointOnPipe;
+		Output.PenetrationDepth = Radius - Distance;
+		Output.ContactNormal = Distance > KINDA_SMALL_NUMBER ? (Center - PointOnPipe) / Distance : FVector::ZeroVector;
+		return true;
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+}
+
+bool UTetherCollisionDetectionHandler::CheckBroadCollision(const FTetherShape* ShapeA, const FTetherShape* ShapeB) const
+{
+	const uint8 TypeA = ShapeA->GetShapeTypeId();
+	const uint8 TypeB = ShapeB->GetShapeTypeId();
+	if (!FTetherShapeTypeRegistry::IsValidId(TypeA) || !FTetherShapeTypeRegistry::IsValidId(TypeB))
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Broad_Pipe_AABB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Broad_Pipe_BoundingSphere(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Broad_Pipe_OBB(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Broad_Pipe_Capsule(A, B);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Broad_Pipe_Pipe(A, B);
-		}
+		return false;
+	}
+
+	const FTetherCollisionDispatchTable::FBroadEntry& Entry = GetDispatchTable().Broad[TypeA][TypeB];
+	if (!Entry.Func)
+	{
+		// Shapes without a dedicated routine, e.g. convex hulls, rely on their cached bounds
+		return ShapeA->GetBounds().Intersects(ShapeB->GetBounds());
 	}
 	
-	return false;
+	return Entry.bSwap ? Entry.Func(ShapeB, ShapeA) : Entry.Func(ShapeA, ShapeB);
 }
 
 bool UTetherCollisionDetectionHandler::CheckNarrowCollision(const FTetherShape* ShapeA, const FTetherShape* ShapeB, FNarrowPhaseCollision& Output) const
 {
-	if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
+	const uint8 TypeA = ShapeA->GetShapeTypeId();
+	const uint8 TypeB = ShapeB->GetShapeTypeId();
+	if (!FTetherShapeTypeRegistry::IsValidId(TypeA) || !FTetherShapeTypeRegistry::IsValidId(TypeB))
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Narrow_AABB_AABB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Narrow_AABB_BoundingSphere(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Narrow_AABB_OBB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Narrow_AABB_Capsule(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Narrow_AABB_Pipe(A, B, Output);
-		}
+		return false;
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
+
+	// Compounds descend to whichever children could be touching, those may be of any type
+	if (FTetherShape_Compound::IsCompound(*ShapeA) || FTetherShape_Compound::IsCompound(*ShapeB))
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Narrow_OBB_AABB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Narrow_OBB_BoundingSphere(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Narrow_OBB_OBB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Narrow_OBB_Capsule(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Narrow_OBB_Pipe(A, B, Output);
-		}
+		return CheckNarrowCollisionCompound(ShapeA, ShapeB, Output);
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
+
+	const FTetherCollisionDispatchTable::FNarrowEntry& Entry = GetDispatchTable().Narrow[TypeA][TypeB];
+	if (!Entry.Func)
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Narrow_BoundingSphere_AABB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Narrow_BoundingSphere_BoundingSphere(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Narrow_BoundingSphere_OBB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Narrow_BoundingSphere_Capsule(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Narrow_BoundingSphere_Pipe(A, B, Output);
-		}
+		return CheckNarrowCollisionConvex(ShapeA, ShapeB, Output);
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
+
+	if (!Entry.bSwap)
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Narrow_Capsule_AABB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Narrow_Capsule_BoundingSphere(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Narrow_Capsule_OBB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Narrow_Capsule_Capsule(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Narrow_Capsule_Pipe(A, B, Output);
-		}
+		return Entry.Func(ShapeA, ShapeB, Output);
 	}
-	else if (ShapeA->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+
+	// Routine was registered for (B, A), flip the normal so it still points from A to B
+	const bool bResult = Entry.Func(ShapeB, ShapeA, Output);
+	Output.ContactNormal = -Output.ContactNormal;
+	return bResult;
+}
+
+bool UTetherCollisionDetectionHandler::CheckNarrowCollisionConvex(const FTetherShape* ShapeA, const FTetherShape* ShapeB,
+	FNarrowPhaseCollision& Output, FTetherGJKSimplex* Simplex) const
+{
+	// Pipes are concave, GJK would collide with their hull and fill the hole, so test their convex segments instead
+	const bool bPipeA = FTetherShape_Pipe::IsPipe(*ShapeA);
+	const bool bPipeB = FTetherShape_Pipe::IsPipe(*ShapeB);
+	if (bPipeA && bPipeB)
 	{
-		const auto* A = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeA);
-		if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox)
-		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(ShapeB);
-			return Narrow_Pipe_AABB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_BoundingSphere)
+		return Narrow_Pipe_Pipe(static_cast<const FTetherShape_Pipe*>(ShapeA), static_cast<const FTetherShape_Pipe*>(ShapeB), Output);
+	}
+	if (bPipeA)
+	{
+		return Narrow_Pipe_Convex(static_cast<const FTetherShape_Pipe*>(ShapeA), ShapeB, Output);
+	}
+	if (bPipeB)
+	{
+		// Flip the normal so it still points from A to B
+		const bool bResult = Narrow_Pipe_Convex(static_cast<const FTetherShape_Pipe*>(ShapeB), ShapeA, Output);
+		Output.ContactNormal = -Output.ContactNormal;
+		return bResult;
+	}
+
+	return Narrow_Convex(ShapeA, ShapeB, Output, Simplex);
+}
+
+bool UTetherCollisionDetectionHandler::CheckNarrowCollisionCompound(const FTetherShape* ShapeA,
+	const FTetherShape* ShapeB, FNarrowPhaseCollision& Output) const
+{
+	bool bCollision = false;
+	const auto KeepDeepest = [this, &Output, &bCollision](const FTetherShape* ChildA, const FTetherShape* ChildB)
+	{
+		FNarrowPhaseCollision ChildOutput { ChildA, ChildB };
+		if (CheckNarrowCollision(ChildA, ChildB, ChildOutput) && (!bCollision || ChildOutput.PenetrationDepth > Output.PenetrationDepth))
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(ShapeB);
-			return Narrow_Pipe_BoundingSphere(A, B, Output);
+			Output.ContactPoint = ChildOutput.ContactPoint;
+			Output.ContactNormal = ChildOutput.ContactNormal;
+			Output.PenetrationDepth = ChildOutput.PenetrationDepth;
+			bCollision = true;
 		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_OrientedBoundingBox)
+	};
+
+	// When both are compounds, each child of A recurses into the children of B
+	if (FTetherShape_Compound::IsCompound(*ShapeA))
+	{
+		static_cast<const FTetherShape_Compound*>(ShapeA)->ForEachOverlappingChild(ShapeB->GetBounds(),
+			[ShapeB, &KeepDeepest](const FTetherShape& Child) { KeepDeepest(&Child, ShapeB); });
+	}
+	else
+	{
+		static_cast<const FTetherShape_Compound*>(ShapeB)->ForEachOverlappingChild(ShapeA->GetBounds(),
+			[ShapeA, &KeepDeepest](const FTetherShape& Child) { KeepDeepest(ShapeA, &Child); });
+	}
+	return bCollision;
+}
+
+bool UTetherCollisionDetectionHandler::HasNarrowCollision(uint8 TypeA, uint8 TypeB)
+{
+	return FTetherShapeTypeRegistry::IsValidId(TypeA) && FTetherShapeTypeRegistry::IsValidId(TypeB) &&
+		GetDispatchTable().Narrow[TypeA][TypeB].Func != nullptr;
+}
+
+bool UTetherCollisionDetectionHandler::Narrow_Convex(const FTetherShape* A, const FTetherShape* B,
+	FNarrowPhaseCollision& Output, FTetherGJKSimplex* Simplex)
+{
+	const FTetherGJKResult Result = FTetherGJK::Query(*A, *B, Simplex);
+	if (!Result.bOverlap)
+	{
+		return false;
+	}
+
+	Output.ContactPoint = (Result.PointA + Result.PointB) * 0.5f;
+	Output.ContactNormal = Result.Normal;
+	Output.PenetrationDepth = Result.PenetrationDepth;
+	return true;
+}
+
+bool UTetherCollisionDetectionHandler::Narrow_Pipe_Convex(const FTetherShape_Pipe* A, const FTetherShape* B,
+	FNarrowPhaseCollision& Output)
+{
+	const UTetherShapeObject* ObjectB = B->GetTetherShapeObject();
+	if (!ObjectB)
+	{
+		return false;
+	}
+
+	const FTetherPipeGeometry Pipe = A->GetGeometry();
+	const FTetherShapeBounds& BoundsB = B->GetBounds();
+	const auto SupportB = [B, ObjectB](const FVector& Direction) { return ObjectB->GetSupportPoint(*B, Direction); };
+
+	// The cuts between neighbouring segments are internal faces, a shape straddling one may report a shallow push
+	// through it from one segment, so keep the deepest contact of all the segments
+	bool bCollision = false;
+	const int32 NumSegments = Pipe.GetNumSegments();
+	for (int32 Segment = 0; Segment < NumSegments; Segment++)
+	{
+		FVector2D Start, End;
+		Pipe.GetSegmentDirections(Segment, Start, End);
+		const auto SupportA = [&Pipe, &Start, &End](const FVector& Direction)
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(ShapeB);
-			return Narrow_Pipe_OBB(A, B, Output);
-		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Capsule)
+			return Pipe.GetSegmentSupportPoint(Start, End, Direction);
+		};
+
+		// Skip segments nowhere near B, the support along each axis gives the segment's bounds
+		const FVector Min(SupportA(FVector::BackwardVector).X, SupportA(FVector::LeftVector).Y, SupportA(FVector::DownVector).Z);
+		const FVector Max(SupportA(FVector::ForwardVector).X, SupportA(FVector::RightVector).Y, SupportA(FVector::UpVector).Z);
+		if (!FTetherShapeBounds(Min, Max).Intersects(BoundsB))
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(ShapeB);
-			return Narrow_Pipe_Capsule(A, B, Output);
+			continue;
 		}
-		else if (ShapeB->GetShapeType() == FTetherGameplayTags::Tether_Shape_Pipe)
+
+		const FTetherGJKResult Result = FTetherGJK::Query(SupportA, SupportB, (Min + Max) * 0.5 - BoundsB.Center);
+		if (Result.bOverlap && (!bCollision || Result.PenetrationDepth > Output.PenetrationDepth))
 		{
-			const auto* B = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(ShapeB);
-			return Narrow_Pipe_Pipe(A, B, Output);
+			Output.ContactPoint = (Result.PointA + Result.PointB) * 0.5f;
+			Output.ContactNormal = Result.Normal;
+			Output.PenetrationDepth = Result.PenetrationDepth;
+			bCollision = true;
 		}
 	}
+	return bCollision;
+}
 
-	return false;
+void FTetherCollisionDispatchTable::AddBroad(const FGameplayTag& TypeA, const FGameplayTag& TypeB, FBroadFunc Func,
+	bool bSymmetric)
+{
+	const uint8 IdA = FTetherShapeTypeRegistry::GetShapeTypeId(TypeA);
+	const uint8 IdB = FTetherShapeTypeRegistry::GetShapeTypeId(TypeB);
+	if (!ensure(FTetherShapeTypeRegistry::IsValidId(IdA) && FTetherShapeTypeRegistry::IsValidId(IdB)))
+	{
+		return;
+	}
+
+	Broad[IdA][IdB] = { Func, false };
+
+	if (bSymmetric && IdA != IdB && !Broad[IdB][IdA].Func)
+	{
+		Broad[IdB][IdA] = { Func, true };
+	}
+}
+
+void FTetherCollisionDispatchTable::AddNarrow(const FGameplayTag& TypeA, const FGameplayTag& TypeB, FNarrowFunc Func,
+	bool bSymmetric)
+{
+	const uint8 IdA = FTetherShapeTypeRegistry::GetShapeTypeId(TypeA);
+	const uint8 IdB = FTetherShapeTypeRegistry::GetShapeTypeId(TypeB);
+	if (!ensure(FTetherShapeTypeRegistry::IsValidId(IdA) && FTetherShapeTypeRegistry::IsValidId(IdB)))
+	{
+		return;
+	}
+
+	Narrow[IdA][IdB] = { Func, false };
+
+	if (bSymmetric && IdA != IdB && !Narrow[IdB][IdA].Func)
+	{
+		Narrow[IdB][IdA] = { Func, true };
+	}
+}
+
+FTetherCollisionDispatchTable& UTetherCollisionDetectionHandler::GetDispatchTable()
+{
+	static FTetherCollisionDispatchTable Table = []()
+	{
+		FTetherCollisionDispatchTable Defaults;
+		RegisterDefaultCollisions(Defaults);
+		return Defaults;
+	}();
+	return Table;
+}
+
+void UTetherCollisionDetectionHandler::RegisterBroadCollision(const FGameplayTag& TypeA, const FGameplayTag& TypeB,
+	FTetherCollisionDispatchTable::FBroadFunc Func, bool bSymmetric)
+{
+	GetDispatchTable().AddBroad(TypeA, TypeB, Func, bSymmetric);
+}
+
+void UTetherCollisionDetectionHandler::RegisterNarrowCollision(const FGameplayTag& TypeA, const FGameplayTag& TypeB,
+	FTetherCollisionDispatchTable::FNarrowFunc Func, bool bSymmetric)
+{
+	GetDispatchTable().AddNarrow(TypeA, TypeB, Func, bSymmetric);
+}
+
+void UTetherCollisionDetectionHandler::RegisterDefaultCollisions(FTetherCollisionDispatchTable& Table)
+{
+	using FAABB = FTetherShape_AxisAlignedBoundingBox;
+	using FSphere = FTetherShape_BoundingSphere;
+	using FOBB = FTetherShape_OrientedBoundingBox;
+	using FCapsule = FTetherShape_Capsule;
+	using FPipe = FTetherShape_Pipe;
+
+	// Every built-in pair has a dedicated routine, so none of these need the symmetric swap
+	Table.AddBroad(FAABB::StaticShapeType(), FAABB::StaticShapeType(), &BroadThunk<FAABB, FAABB, &Broad_AABB_AABB>, false);
+	Table.AddBroad(FAABB::StaticShapeType(), FSphere::StaticShapeType(), &BroadThunk<FAABB, FSphere, &Broad_AABB_BoundingSphere>, false);
+	Table.AddBroad(FAABB::StaticShapeType(), FOBB::StaticShapeType(), &BroadThunk<FAABB, FOBB, &Broad_AABB_OBB>, false);
+	Table.AddBroad(FAABB::StaticShapeType(), FCapsule::StaticShapeType(), &BroadThunk<FAABB, FCapsule, &Broad_AABB_Capsule>, false);
+	Table.AddBroad(FAABB::StaticShapeType(), FPipe::StaticShapeType(), &BroadThunk<FAABB, FPipe, &Broad_AABB_Pipe>, false);
+	Table.AddBroad(FSphere::StaticShapeType(), FAABB::StaticShapeType(), &BroadThunk<FSphere, FAABB, &Broad_BoundingSphere_AABB>, false);
+	Table.AddBroad(FSphere::StaticShapeType(), FSphere::StaticShapeType(), &BroadThunk<FSphere, FSphere, &Broad_BoundingSphere_BoundingSphere>, false);
+	Table.AddBroad(FSphere::StaticShapeType(), FOBB::StaticShapeType(), &BroadThunk<FSphere, FOBB, &Broad_BoundingSphere_OBB>, false);
+	Table.AddBroad(FSphere::StaticShapeType(), FCapsule::StaticShapeType(), &BroadThunk<FSphere, FCapsule, &Broad_BoundingSphere_Capsule>, false);
+	Table.AddBroad(FSphere::StaticShapeType(), FPipe::StaticShapeType(), &BroadThunk<FSphere, FPipe, &Broad_BoundingSphere_Pipe>, false);
+	Table.AddBroad(FOBB::StaticShapeType(), FAABB::StaticShapeType(), &BroadThunk<FOBB, FAABB, &Broad_OBB_AABB>, false);
+	Table.AddBroad(FOBB::StaticShapeType(), FSphere::StaticShapeType(), &BroadThunk<FOBB, FSphere, &Broad_OBB_BoundingSphere>, false);
+	Table.AddBroad(FOBB::StaticShapeType(), FOBB::StaticShapeType(), &BroadThunk<FOBB, FOBB, &Broad_OBB_OBB>, false);
+	Table.AddBroad(FOBB::StaticShapeType(), FCapsule::StaticShapeType(), &BroadThunk<FOBB, FCapsule, &Broad_OBB_Capsule>, false);
+	Table.AddBroad(FOBB::StaticShapeType(), FPipe::StaticShapeType(), &BroadThunk<FOBB, FPipe, &Broad_OBB_Pipe>, false);
+	Table.AddBroad(FCapsule::StaticShapeType(), FAABB::StaticShapeType(), &BroadThunk<FCapsule, FAABB, &Broad_Capsule_AABB>, false);
+	Table.AddBroad(FCapsule::StaticShapeType(), FSphere::StaticShapeType(), &BroadThunk<FCapsule, FSphere, &Broad_Capsule_BoundingSphere>, false);
+	Table.AddBroad(FCapsule::StaticShapeType(), FOBB::StaticShapeType(), &BroadThunk<FCapsule, FOBB, &Broad_Capsule_OBB>, false);
+	Table.AddBroad(FCapsule::StaticShapeType(), FCapsule::StaticShapeType(), &BroadThunk<FCapsule, FCapsule, &Broad_Capsule_Capsule>, false);
+	Table.AddBroad(FCapsule::StaticShapeType(), FPipe::StaticShapeType(), &BroadThunk<FCapsule, FPipe, &Broad_Capsule_Pipe>, false);
+	Table.AddBroad(FPipe::StaticShapeType(), FAABB::StaticShapeType(), &BroadThunk<FPipe, FAABB, &Broad_Pipe_AABB>, false);
+	Table.AddBroad(FPipe::StaticShapeType(), FSphere::StaticShapeType(), &BroadThunk<FPipe, FSphere, &Broad_Pipe_BoundingSphere>, false);
+	Table.AddBroad(FPipe::StaticShapeType(), FOBB::StaticShapeType(), &BroadThunk<FPipe, FOBB, &Broad_Pipe_OBB>, false);
+	Table.AddBroad(FPipe::StaticShapeType(), FCapsule::StaticShapeType(), &BroadThunk<FPipe, FCapsule, &Broad_Pipe_Capsule>, false);
+	Table.AddBroad(FPipe::StaticShapeType(), FPipe::StaticShapeType(), &BroadThunk<FPipe, FPipe, &Broad_Pipe_Pipe>, false);
+
+	Table.AddNarrow(FAABB::StaticShapeType(), FAABB::StaticShapeType(), &NarrowThunk<FAABB, FAABB, &Narrow_AABB_AABB>, false);
+	Table.AddNarrow(FAABB::StaticShapeType(), FSphere::StaticShapeType(), &NarrowThunk<FAABB, FSphere, &Narrow_AABB_BoundingSphere>, false);
+	Table.AddNarrow(FAABB::StaticShapeType(), FOBB::StaticShapeType(), &NarrowThunk<FAABB, FOBB, &Narrow_AABB_OBB>, false);
+	Table.AddNarrow(FAABB::StaticShapeType(), FCapsule::StaticShapeType(), &NarrowThunk<FAABB, FCapsule, &Narrow_AABB_Capsule>, false);
+	Table.AddNarrow(FAABB::StaticShapeType(), FPipe::StaticShapeType(), &NarrowThunk<FAABB, FPipe, &Narrow_AABB_Pipe>, false);
+	Table.AddNarrow(FSphere::StaticShapeType(), FAABB::StaticShapeType(), &NarrowThunk<FSphere, FAABB, &Narrow_BoundingSphere_AABB>, false);
+	Table.AddNarrow(FSphere::StaticShapeType(), FSphere::StaticShapeType(), &NarrowThunk<FSphere, FSphere, &Narrow_BoundingSphere_BoundingSphere>, false);
+	Table.AddNarrow(FSphere::StaticShapeType(), FOBB::StaticShapeType(), &NarrowThunk<FSphere, FOBB, &Narrow_BoundingSphere_OBB>, false);
+	Table.AddNarrow(FSphere::StaticShapeType(), FCapsule::StaticShapeType(), &NarrowThunk<FSphere, FCapsule, &Narrow_BoundingSphere_Capsule>, false);
+	Table.AddNarrow(FSphere::StaticShapeType(), FPipe::StaticShapeType(), &NarrowThunk<FSphere, FPipe, &Narrow_BoundingSphere_Pipe>, false);
+	Table.AddNarrow(FOBB::StaticShapeType(), FAABB::StaticShapeType(), &NarrowThunk<FOBB, FAABB, &Narrow_OBB_AABB>, false);
+	Table.AddNarrow(FOBB::StaticShapeType(), FSphere::StaticShapeType(), &NarrowThunk<FOBB, FSphere, &Narrow_OBB_BoundingSphere>, false);
+	Table.AddNarrow(FOBB::StaticShapeType(), FOBB::StaticShapeType(), &NarrowThunk<FOBB, FOBB, &Narrow_OBB_OBB>, false);
+	Table.AddNarrow(FOBB::StaticShapeType(), FCapsule::StaticShapeType(), &NarrowThunk<FOBB, FCapsule, &Narrow_OBB_Capsule>, false);
+	Table.AddNarrow(FOBB::StaticShapeType(), FPipe::StaticShapeType(), &NarrowThunk<FOBB, FPipe, &Narrow_OBB_Pipe>, false);
+	Table.AddNarrow(FCapsule::StaticShapeType(), FAABB::StaticShapeType(), &NarrowThunk<FCapsule, FAABB, &Narrow_Capsule_AABB>, false);
+	Table.AddNarrow(FCapsule::StaticShapeType(), FSphere::StaticShapeType(), &NarrowThunk<FCapsule, FSphere, &Narrow_Capsule_BoundingSphere>, false);
+	Table.AddNarrow(FCapsule::StaticShapeType(), FOBB::StaticShapeType(), &NarrowThunk<FCapsule, FOBB, &Narrow_Capsule_OBB>, false);
+	Table.AddNarrow(FCapsule::StaticShapeType(), FCapsule::StaticShapeType(), &NarrowThunk<FCapsule, FCapsule, &Narrow_Capsule_Capsule>, false);
+	Table.AddNarrow(FCapsule::StaticShapeType(), FPipe::StaticShapeType(), &NarrowThunk<FCapsule, FPipe, &Narrow_Capsule_Pipe>, false);
+	Table.AddNarrow(FPipe::StaticShapeType(), FAABB::StaticShapeType(), &NarrowThunk<FPipe, FAABB, &Narrow_Pipe_AABB>, false);
+	Table.AddNarrow(FPipe::StaticShapeType(), FSphere::StaticShapeType(), &NarrowThunk<FPipe, FSphere, &Narrow_Pipe_BoundingSphere>, false);
+	Table.AddNarrow(FPipe::StaticShapeType(), FOBB::StaticShapeType(), &NarrowThunk<FPipe, FOBB, &Narrow_Pipe_OBB>, false);
+	Table.AddNarrow(FPipe::StaticShapeType(), FCapsule::StaticShapeType(), &NarrowThunk<FPipe, FCapsule, &Narrow_Pipe_Capsule>, false);
+	Table.AddNarrow(FPipe::StaticShapeType(), FPipe::StaticShapeType(), &NarrowThunk<FPipe, FPipe, &Narrow_Pipe_Pipe>, false);
 }
 
 // AABB vs AABB
@@ -345,26 +547,23 @@ bool UTetherCollisionDetectionHandler::Broad_AABB_BoundingSphere(const FTetherSh
 // AABB vs OBB
 bool UTetherCollisionDetectionHandler::Broad_AABB_OBB(const FTetherShape_AxisAlignedBoundingBox* A, const FTetherShape_OrientedBoundingBox* B)
 {
-	// Call the corresponding OBB vs AABB function (symmetric)
-	FTetherShape_AxisAlignedBoundingBox OBBAABB = B->GetBoundingBox();
-	return Broad_AABB_AABB(A, &OBBAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // AABB vs Capsule
 bool UTetherCollisionDetectionHandler::Broad_AABB_Capsule(const FTetherShape_AxisAlignedBoundingBox* A, const FTetherShape_Capsule* B)
 {
-	// Implement the broad-phase logic for AABB vs Capsule
-	FTetherShape_AxisAlignedBoundingBox CapsuleAABB = B->GetBoundingBox();
-	return Broad_AABB_AABB(A, &CapsuleAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // AABB vs Pipe
 bool UTetherCollisionDetectionHandler::Broad_AABB_Pipe(const FTetherShape_AxisAlignedBoundingBox* A,
 	const FTetherShape_Pipe* B)
 {
-	// Implement the broad-phase logic for AABB vs Pipe
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = B->GetBoundingBox();
-	return Broad_AABB_AABB(A, &PipeAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // BoundingSphere vs AABB
@@ -397,17 +596,16 @@ bool UTetherCollisionDetectionHandler::Broad_BoundingSphere_OBB(const FTetherSha
 // BoundingSphere vs Capsule
 bool UTetherCollisionDetectionHandler::Broad_BoundingSphere_Capsule(const FTetherShape_BoundingSphere* A, const FTetherShape_Capsule* B)
 {
-	// Implement the broad-phase logic for BoundingSphere vs Capsule
-	FTetherShape_AxisAlignedBoundingBox CapsuleAABB = B->GetBoundingBox();
-	return Broad_BoundingSphere_AABB(A, &CapsuleAABB);
+	// Cached bounds of B vs the sphere
+	return B->GetBounds().IntersectsSphere(A->Center, A->Radius);
 }
 
 // BoundingSphere vs Pipe
 bool UTetherCollisionDetectionHandler::Broad_BoundingSphere_Pipe(const FTetherShape_BoundingSphere* A,
 	const FTetherShape_Pipe* B)
 {
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = B->GetBoundingBox();
-	return Broad_AABB_BoundingSphere(&PipeAABB, A);
+	// Cached bounds of B vs the sphere
+	return B->GetBounds().IntersectsSphere(A->Center, A->Radius);
 }
 
 // OBB vs AABB
@@ -420,18 +618,15 @@ bool UTetherCollisionDetectionHandler::Broad_OBB_AABB(const FTetherShape_Oriente
 // OBB vs BoundingSphere
 bool UTetherCollisionDetectionHandler::Broad_OBB_BoundingSphere(const FTetherShape_OrientedBoundingBox* A, const FTetherShape_BoundingSphere* B)
 {
-	// Implement the broad-phase logic for OBB vs BoundingSphere
-	FTetherShape_AxisAlignedBoundingBox OBBAABB = A->GetBoundingBox();
-	return Broad_BoundingSphere_AABB(B, &OBBAABB);
+	// Cached bounds of A vs the sphere
+	return A->GetBounds().IntersectsSphere(B->Center, B->Radius);
 }
 
 // OBB vs OBB
 bool UTetherCollisionDetectionHandler::Broad_OBB_OBB(const FTetherShape_OrientedBoundingBox* A, const FTetherShape_OrientedBoundingBox* B)
 {
-	// Implement the broad-phase logic for OBB vs OBB
-	FTetherShape_AxisAlignedBoundingBox AABB_A = A->GetBoundingBox();
-	FTetherShape_AxisAlignedBoundingBox AABB_B = B->GetBoundingBox();
-	return Broad_AABB_AABB(&AABB_A, &AABB_B);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // OBB vs Capsule
@@ -445,92 +640,81 @@ bool UTetherCollisionDetectionHandler::Broad_OBB_Capsule(const FTetherShape_Orie
 bool UTetherCollisionDetectionHandler::Broad_OBB_Pipe(const FTetherShape_OrientedBoundingBox* A,
 	const FTetherShape_Pipe* B)
 {
-	// Implement the broad-phase logic for OBB vs Pipe
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = B->GetBoundingBox();
-	return Broad_OBB_AABB(A, &PipeAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Capsule vs AABB
 bool UTetherCollisionDetectionHandler::Broad_Capsule_AABB(const FTetherShape_Capsule* A, const FTetherShape_AxisAlignedBoundingBox* B)
 {
-	// Implement the broad-phase logic for Capsule vs AABB
-	FTetherShape_AxisAlignedBoundingBox CapsuleAABB = A->GetBoundingBox();
-	return Broad_AABB_AABB(&CapsuleAABB, B);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Capsule vs BoundingSphere
 bool UTetherCollisionDetectionHandler::Broad_Capsule_BoundingSphere(const FTetherShape_Capsule* A, const FTetherShape_BoundingSphere* B)
 {
-	// Implement the broad-phase logic for Capsule vs BoundingSphere
-	FTetherShape_AxisAlignedBoundingBox CapsuleAABB = A->GetBoundingBox();
-	return Broad_BoundingSphere_AABB(B, &CapsuleAABB);
+	// Cached bounds of A vs the sphere
+	return A->GetBounds().IntersectsSphere(B->Center, B->Radius);
 }
 
 // Capsule vs OBB
 bool UTetherCollisionDetectionHandler::Broad_Capsule_OBB(const FTetherShape_Capsule* A, const FTetherShape_OrientedBoundingBox* B)
 {
-	// Implement the broad-phase logic for Capsule vs OBB
-	FTetherShape_AxisAlignedBoundingBox CapsuleAABB = A->GetBoundingBox();
-	FTetherShape_AxisAlignedBoundingBox OBBAABB = B->GetBoundingBox();
-	return Broad_AABB_AABB(&CapsuleAABB, &OBBAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Capsule vs Capsule
 bool UTetherCollisionDetectionHandler::Broad_Capsule_Capsule(const FTetherShape_Capsule* A, const FTetherShape_Capsule* B)
 {
-	// Implement the broad-phase logic for Capsule vs Capsule
-	FTetherShape_AxisAlignedBoundingBox AABB_A = A->GetBoundingBox();
-	FTetherShape_AxisAlignedBoundingBox AABB_B = B->GetBoundingBox();
-	return Broad_AABB_AABB(&AABB_A, &AABB_B);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Capsule vs Pipe
 bool UTetherCollisionDetectionHandler::Broad_Capsule_Pipe(const FTetherShape_Capsule* A, const FTetherShape_Pipe* B)
 {
-	// Implement the broad-phase logic for Capsule vs Pipe
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = B->GetBoundingBox();
-	return Broad_Capsule_AABB(A, &PipeAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Pipe vs AABB
 bool UTetherCollisionDetectionHandler::Broad_Pipe_AABB(const FTetherShape_Pipe* A,
 	const FTetherShape_AxisAlignedBoundingBox* B)
 {
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = A->GetBoundingBox();
-	return Broad_AABB_AABB(&PipeAABB, B);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Pipe vs BoundingSphere
 bool UTetherCollisionDetectionHandler::Broad_Pipe_BoundingSphere(const FTetherShape_Pipe* A,
 	const FTetherShape_BoundingSphere* B)
 {
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = A->GetBoundingBox();
-	return Broad_AABB_BoundingSphere(&PipeAABB, B);
+	// Cached bounds of A vs the sphere
+	return A->GetBounds().IntersectsSphere(B->Center, B->Radius);
 }
 
 // Pipe vs OBB
 bool UTetherCollisionDetectionHandler::Broad_Pipe_OBB(const FTetherShape_Pipe* A,
 	const FTetherShape_OrientedBoundingBox* B)
 {
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = A->GetBoundingBox();
-	FTetherShape_AxisAlignedBoundingBox OBBAABB = B->GetBoundingBox();
-	return Broad_AABB_AABB(&PipeAABB, &OBBAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Pipe vs Capsule
 bool UTetherCollisionDetectionHandler::Broad_Pipe_Capsule(const FTetherShape_Pipe* A, const FTetherShape_Capsule* B)
 {
-	FTetherShape_AxisAlignedBoundingBox PipeAABB = A->GetBoundingBox();
-	FTetherShape_AxisAlignedBoundingBox CapsuleAABB = B->GetBoundingBox();
-	return Broad_AABB_AABB(&PipeAABB, &CapsuleAABB);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Pipe vs Pipe
 bool UTetherCollisionDetectionHandler::Broad_Pipe_Pipe(const FTetherShape_Pipe* A, const FTetherShape_Pipe* B)
 {
-	FTetherShape_AxisAlignedBoundingBox AABB_A = A->GetBoundingBox();
-	FTetherShape_AxisAlignedBoundingBox AABB_B = B->GetBoundingBox();
-	return Broad_AABB_AABB(&AABB_A, &AABB_B);
+	// Compare the cached world space bounds
+	return A->GetBounds().Intersects(B->GetBounds());
 }
 
 // Narrow-phase collision check for AABB vs AABB
@@ -614,7 +798,10 @@ bool UTetherCollisionDetectionHandler::Narrow_AABB_Capsule(const FTetherShape_Ax
 bool UTetherCollisionDetectionHandler::Narrow_AABB_Pipe(const FTetherShape_AxisAlignedBoundingBox* A,
 	const FTetherShape_Pipe* B, FNarrowPhaseCollision& Output)
 {
-	return Narrow_Pipe_AABB(B, A, Output); // Symmetric to Pipe vs AABB
+	// Symmetric to Pipe vs AABB, flip the normal so it points from A to B
+	const bool bResult = Narrow_Pipe_AABB(B, A, Output);
+	Output.ContactNormal = -Output.ContactNormal;
+	return bResult;
 }
 
 // Narrow-phase collision check for BoundingSphere vs AABB
@@ -676,12 +863,19 @@ bool UTetherCollisionDetectionHandler::Narrow_BoundingSphere_OBB(const FTetherSh
 // Narrow-phase collision check for BoundingSphere vs Capsule
 bool UTetherCollisionDetectionHandler::Narrow_BoundingSphere_Capsule(const FTetherShape_BoundingSphere* A, const FTetherShape_Capsule* B, FNarrowPhaseCollision& Output)
 {
-	// Implement a more precise narrow-phase check for BoundingSphere vs Capsule
-	if (Broad_BoundingSphere_Capsule(A, B))
+	// Find the closest point on the capsule's segment to the sphere center
+	FVector Bottom, Top;
+	B->GetSegment(Bottom, Top);
+	const FVector ClosestPoint = FMath::ClosestPointOnSegment(A->Center, Bottom, Top);
+
+	const float DistanceSquared = FVector::DistSquared(A->Center, ClosestPoint);
+	const float RadiusSum = A->Radius + B->Radius;
+
+	if (DistanceSquared <= FMath::Square(RadiusSum))
 	{
-		// Placeholder: Assume collision at center points
-		Output.ContactPoint = (A->Center + B->GetLocalSpaceCenter()) * 0.5f;
-		Output.PenetrationDepth = 0.0f; // Placeholder for actual penetration depth calculation
+		// Contact at the midpoint between the sphere center and the closest point
+		Output.ContactPoint = (A->Center + ClosestPoint) * 0.5f;
+		Output.PenetrationDepth = RadiusSum - FMath::Sqrt(DistanceSquared);
 		return true;
 	}
 	return false;
@@ -691,7 +885,10 @@ bool UTetherCollisionDetectionHandler::Narrow_BoundingSphere_Capsule(const FTeth
 bool UTetherCollisionDetectionHandler::Narrow_BoundingSphere_Pipe(const FTetherShape_BoundingSphere* A,
 	const FTetherShape_Pipe* B, FNarrowPhaseCollision& Output)
 {
-	return Narrow_Pipe_BoundingSphere(B, A, Output); // Symmetric to Pipe vs BoundingSphere
+	// Symmetric to Pipe vs BoundingSphere, flip the normal so it points from A to B
+	const bool bResult = Narrow_Pipe_BoundingSphere(B, A, Output);
+	Output.ContactNormal = -Output.ContactNormal;
+	return bResult;
 }
 
 // Narrow-phase collision check for OBB vs AABB
@@ -860,7 +1057,10 @@ bool UTetherCollisionDetectionHandler::Narrow_OBB_Capsule(const FTetherShape_Ori
 bool UTetherCollisionDetectionHandler::Narrow_OBB_Pipe(const FTetherShape_OrientedBoundingBox* A,
 	const FTetherShape_Pipe* B, FNarrowPhaseCollision& Output)
 {
-	return Narrow_Pipe_OBB(B, A, Output); // Symmetric to Pipe vs OBB
+	// Symmetric to Pipe vs OBB, flip the normal so it points from A to B
+	const bool bResult = Narrow_Pipe_OBB(B, A, Output);
+	Output.ContactNormal = -Output.ContactNormal;
+	return bResult;
 }
 
 // Narrow-phase collision check for Capsule vs AABB
@@ -929,331 +1129,85 @@ bool UTetherCollisionDetectionHandler::Narrow_Capsule_Capsule(const FTetherShape
 bool UTetherCollisionDetectionHandler::Narrow_Capsule_Pipe(const FTetherShape_Capsule* A, const FTetherShape_Pipe* B,
 	FNarrowPhaseCollision& Output)
 {
-	// @todo
-	return false;
-	// // Calculate the top and bottom points of the capsule (including hemispheres)
-	// FVector CapsuleTop = A->Center + A->Rotation.RotateVector(FVector::UpVector) * A->HalfHeight;
-	// FVector CapsuleBottom = A->Center - A->Rotation.RotateVector(FVector::UpVector) * A->HalfHeight;
-	//
-	// // Find the closest point on the pipe to the capsule's line segment
-	// float ClosestDistanceSquared = FLT_MAX;
-	// FVector ClosestPointOnPipe;
-	//
-	// // Sample points along the arc of the pipe to find the closest one
-	// constexpr int32 NumSamples = 36; // Adjust this for more precision
-	// const float AngleStep = FMath::DegreesToRadians(B->ArcAngle) / NumSamples;
-	//
-	// for (int32 i = 0; i <= NumSamples; ++i)
-	// {
-	// 	float Angle = i * AngleStep;
-	//
-	// 	// Calculate a point on the outer surface of the pipe
-	// 	FVector PointOnArcOuter = B->Center + B->Rotation.RotateVector(FVector(FMath::Cos(Angle) * B->OuterDimensions.X, FMath::Sin(Angle) * B->OuterDimensions.Y, 0.0f));
-	//
-	// 	// Offset by the thickness in the Z direction to represent the 3D thickness
-	// 	PointOnArcOuter.Z += B->OuterDimensions.Z * 0.5f;
-	//
-	// 	// Find the closest point on the capsule's line segment to this point on the pipe's arc
-	// 	FVector ClosestPointOnCapsule;
-	// 	FMath::SegmentDistToSegmentSafe(CapsuleBottom, CapsuleTop, PointOnArcOuter, PointOnArcOuter, ClosestPointOnCapsule, PointOnArcOuter);
-	//
-	// 	float DistanceSquared = FVector::DistSquared(ClosestPointOnCapsule, PointOnArcOuter);
-	// 	if (DistanceSquared < ClosestDistanceSquared)
-	// 	{
-	// 		ClosestDistanceSquared = DistanceSquared;
-	// 		ClosestPointOnPipe = PointOnArcOuter;
-	// 	}
-	// }
-	//
-	// // Determine if the capsule's closest point is within the pipe's thickness
-	// if (ClosestDistanceSquared <= FMath::Square(A->Radius))
-	// {
-	// 	Output.ContactPoint = ClosestPointOnPipe;
-	// 	Output.PenetrationDepth = A->Radius - FMath::Sqrt(ClosestDistanceSquared);
-	// 	return true;
-	// }
-	//
-	// return false;
+	// Symmetric to Pipe vs Capsule, flip the normal so it points from A to B
+	const bool bResult = Narrow_Pipe_Capsule(B, A, Output);
+	Output.ContactNormal = -Output.ContactNormal;
+	return bResult;
 }
 
 bool UTetherCollisionDetectionHandler::Narrow_Pipe_AABB(const FTetherShape_Pipe* A,
 	const FTetherShape_AxisAlignedBoundingBox* B, FNarrowPhaseCollision& Output)
 {
-	// @todo
-	return false;
-	// // 1. Transform the AABB and Pipe to world space
-	// FVector PipeCenter = A->Center;
-	// FVector PipeOuterDimensions = A->OuterDimensions;
-	// float PipeArcAngle = A->ArcAngle;
-	// FQuat PipeRotation = A->Rotation.Quaternion();
-	//
-	// FVector AABBMin = B->Min;
-	// FVector AABBMax = B->Max;
-	//
-	// // 2. Approximate the pipe as a set of line segments and check for intersection with AABB
-	//
-	// int32 NumSegments = FMath::Max(12, FMath::RoundToInt(PipeArcAngle / 5.f)); // More segments for smoother arcs
-	// float AngleStep = PipeArcAngle / NumSegments;
-	//
-	// for (int32 i = 0; i < NumSegments; ++i)
-	// {
-	// 	float AngleStart = FMath::DegreesToRadians(i * AngleStep);
-	// 	float AngleEnd = FMath::DegreesToRadians((i + 1) * AngleStep);
-	//
-	// 	// Start and end points of the pipe segment
-	// 	FVector SegmentStart = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleStart), PipeOuterDimensions.Y * FMath::Sin(AngleStart), 0.0f));
-	// 	FVector SegmentEnd = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleEnd), PipeOuterDimensions.Y * FMath::Sin(AngleEnd), 0.0f));
-	//
-	// 	// Check if this segment intersects with the AABB
-	// 	if (FMath::LineBoxIntersection(FBox(AABBMin, AABBMax), SegmentStart, SegmentEnd, FVector::ZeroVector))
-	// 	{
-	// 		Output.ContactPoint = (SegmentStart + SegmentEnd) * 0.5f;
-	// 		Output.PenetrationDepth = 0.0f; // Placeholder for actual penetration depth calculation
-	// 		return true;
-	// 	}
-	// }
-	//
-	// return false;
+	return Narrow_Pipe_Convex(A, B, Output);
 }
 
 bool UTetherCollisionDetectionHandler::Narrow_Pipe_BoundingSphere(const FTetherShape_Pipe* A,
 	const FTetherShape_BoundingSphere* B, FNarrowPhaseCollision& Output)
 {
-	// @todo
-	return false;
-	// // Transform the pipe and sphere to world space
-	// FVector PipeCenter = A->Center;
-	// FVector PipeOuterDimensions = A->OuterDimensions;
-	// float PipeArcAngle = A->ArcAngle;
-	// FQuat PipeRotation = A->Rotation.Quaternion();
-	//
-	// FVector SphereCenter = B->Center;
-	// float SphereRadius = B->Radius;
-	//
-	// // Approximate the pipe as a set of line segments
-	// int32 NumSegments = FMath::Max(12, FMath::RoundToInt(PipeArcAngle / 5.f)); // More segments for smoother arcs
-	// float AngleStep = PipeArcAngle / NumSegments;
-	//
-	// for (int32 i = 0; i < NumSegments; ++i)
-	// {
-	// 	float AngleStart = FMath::DegreesToRadians(i * AngleStep);
-	// 	float AngleEnd = FMath::DegreesToRadians((i + 1) * AngleStep);
-	//
-	// 	// Start and end points of the pipe segment
-	// 	FVector SegmentStart = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleStart), PipeOuterDimensions.Y * FMath::Sin(AngleStart), 0.0f));
-	// 	FVector SegmentEnd = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleEnd), PipeOuterDimensions.Y * FMath::Sin(AngleEnd), 0.0f));
-	//
-	// 	// Find the closest point on the segment to the sphere's center
-	// 	FVector ClosestPoint = FMath::ClosestPointOnSegment(SphereCenter, SegmentStart, SegmentEnd);
-	//
-	// 	// Check if the distance from the closest point to the sphere's center is less than the sphere's radius
-	// 	if (FVector::DistSquared(ClosestPoint, SphereCenter) <= FMath::Square(SphereRadius))
-	// 	{
-	// 		Output.ContactPoint = ClosestPoint;
-	// 		Output.PenetrationDepth = SphereRadius - FVector::Dist(ClosestPoint, SphereCenter);
-	// 		return true;
-	// 	}
-	// }
-	//
-	// return false;
+	// The closest point on the pipe is closed-form, no iterations required
+	const FTetherPipeGeometry Pipe = A->GetGeometry();
+	bool bInside = false;
+	const FVector PointOnPipe = Pipe.GetClosestPoint(B->Center, bInside);
+	return FTetherPipePrivate::ResolveSphere(Pipe, PointOnPipe, B->Center, B->Radius, bInside, Output);
 }
 
 bool UTetherCollisionDetectionHandler::Narrow_Pipe_OBB(const FTetherShape_Pipe* A,
 	const FTetherShape_OrientedBoundingBox* B, FNarrowPhaseCollision& Output)
 {
-	// @todo
-	return false;
-	// // Transform the pipe and OBB to world space
-	// FVector PipeCenter = A->Center;
-	// FVector PipeOuterDimensions = A->OuterDimensions;
-	// float PipeArcAngle = A->ArcAngle;
-	// FQuat PipeRotation = A->Rotation.Quaternion();
-	//
-	// FVector OBBExtent = B->Extent;
-	// FQuat OBBRotation = B->Rotation.Quaternion();
-	// FVector OBBCenter = B->Center;
-	//
-	// // Approximate the pipe as a set of line segments
-	// int32 NumSegments = FMath::Max(12, FMath::RoundToInt(PipeArcAngle / 5.f)); // More segments for smoother arcs
-	// float AngleStep = PipeArcAngle / NumSegments;
-	//
-	// for (int32 i = 0; i < NumSegments; ++i)
-	// {
-	// 	float AngleStart = FMath::DegreesToRadians(i * AngleStep);
-	// 	float AngleEnd = FMath::DegreesToRadians((i + 1) * AngleStep);
-	//
-	// 	// Start and end points of the pipe segment
-	// 	FVector SegmentStart = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleStart), PipeOuterDimensions.Y * FMath::Sin(AngleStart), 0.0f));
-	// 	FVector SegmentEnd = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleEnd), PipeOuterDimensions.Y * FMath::Sin(AngleEnd), 0.0f));
-	//
-	// 	// Project the segment onto the OBB's axes
-	// 	if (FMath::LineBoxIntersection(FBox::BuildAABB(OBBCenter, OBBExtent), SegmentStart, SegmentEnd, OBBRotation.RotateVector(FVector::ZeroVector)))
-	// 	{
-	// 		Output.ContactPoint = (SegmentStart + SegmentEnd) * 0.5f;
-	// 		Output.PenetrationDepth = 0.0f; // Placeholder for actual penetration depth calculation
-	// 		return true;
-	// 	}
-	// }
-	//
-	// return false;
+	return Narrow_Pipe_Convex(A, B, Output);
 }
 
 bool UTetherCollisionDetectionHandler::Narrow_Pipe_Capsule(const FTetherShape_Pipe* A, const FTetherShape_Capsule* B,
 	FNarrowPhaseCollision& Output)
 {
-	// @todo
-	return false;
-	// // Transform the pipe and capsule to world space
-	// FVector PipeCenter = A->Center;
-	// FVector PipeOuterDimensions = A->OuterDimensions;
-	// float PipeArcAngle = A->ArcAngle;
-	// FQuat PipeRotation = A->Rotation.Quaternion();
-	//
-	// FVector CapsuleCenter = B->Center;
-	// float CapsuleHalfHeight = B->HalfHeight;
-	// float CapsuleRadius = B->Radius;
-	// FQuat CapsuleRotation = B->Rotation.Quaternion();
-	//
-	// // Approximate the pipe as a set of line segments
-	// int32 NumSegments = FMath::Max(12, FMath::RoundToInt(PipeArcAngle / 5.f)); // More segments for smoother arcs
-	// float AngleStep = PipeArcAngle / NumSegments;
-	//
-	// // Calculate the top and bottom points of the capsule
-	// FVector CapsuleUp = CapsuleRotation.RotateVector(FVector::UpVector) * CapsuleHalfHeight;
-	// FVector CapsuleTop = CapsuleCenter + CapsuleUp;
-	// FVector CapsuleBottom = CapsuleCenter - CapsuleUp;
-	//
-	// for (int32 i = 0; i < NumSegments; ++i)
-	// {
-	// 	float AngleStart = FMath::DegreesToRadians(i * AngleStep);
-	// 	float AngleEnd = FMath::DegreesToRadians((i + 1) * AngleStep);
-	//
-	// 	// Start and end points of the pipe segment
-	// 	FVector SegmentStart = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleStart), PipeOuterDimensions.Y * FMath::Sin(AngleStart), 0.0f));
-	// 	FVector SegmentEnd = PipeCenter + PipeRotation.RotateVector(FVector(PipeOuterDimensions.X * FMath::Cos(AngleEnd), PipeOuterDimensions.Y * FMath::Sin(AngleEnd), 0.0f));
-	//
-	// 	// Find the closest points between the pipe segment and the capsule's segment
-	// 	FVector ClosestPointOnCapsule, ClosestPointOnPipe;
-	// 	FMath::SegmentDistToSegmentSafe(CapsuleBottom, CapsuleTop, SegmentStart, SegmentEnd, ClosestPointOnCapsule, ClosestPointOnPipe);
-	//
-	// 	// Check if the distance between the closest points is less than the combined radii
-	// 	if (FVector::DistSquared(ClosestPointOnCapsule, ClosestPointOnPipe) <= FMath::Square(CapsuleRadius))
-	// 	{
-	// 		Output.ContactPoint = (ClosestPointOnCapsule + ClosestPointOnPipe) * 0.5f;
-	// 		Output.PenetrationDepth = CapsuleRadius - FVector::Dist(ClosestPointOnCapsule, ClosestPointOnPipe);
-	// 		return true;
-	// 	}
-	// }
-	//
-	// return false;
+	FVector Bottom, Top;
+	B->GetSegment(Bottom, Top);
+
+	const auto ProjectOnSegment = [&Bottom, &Top](const FVector& Point, bool& bOutInside)
+	{
+		bOutInside = false;
+		return FMath::ClosestPointOnSegment(Point, Bottom, Top);
+	};
+
+	// Closest points between the pipe and the capsule's segment, then treat it as a sphere at the segment point
+	const FTetherPipeGeometry Pipe = A->GetGeometry();
+	FVector PointOnPipe, PointOnSegment;
+	const bool bOverlap = FTetherPipePrivate::FindClosestPoints(Pipe, B->Center, ProjectOnSegment, PointOnPipe, PointOnSegment);
+	return FTetherPipePrivate::ResolveSphere(Pipe, PointOnPipe, PointOnSegment, B->Radius, bOverlap, Output);
 }
 
 bool UTetherCollisionDetectionHandler::Narrow_Pipe_Pipe(const FTetherShape_Pipe* A, const FTetherShape_Pipe* B, FNarrowPhaseCollision& Output)
 {
-    // Transform both pipes to world space
-    FVector PipeACenter = A->Center;
-    float PipeAOuterRadius = A->OuterRadius;
-    float PipeAInnerRadius = A->InnerRadius;
-    float PipeAThickness = A->Thickness;
-    float PipeAArcAngle = A->ArcAngle;
-    FQuat PipeARotation = A->Rotation.Quaternion();
-
-    FVector PipeBCenter = B->Center;
-    float PipeBOuterRadius = B->OuterRadius;
-    float PipeBInnerRadius = B->InnerRadius;
-    float PipeBThickness = B->Thickness;
-    float PipeBArcAngle = B->ArcAngle;
-    FQuat PipeBRotation = B->Rotation.Quaternion();
-
-    // Check if one pipe is entirely inside the other without overlapping
-    float CenterDistance = FVector::Dist(PipeACenter, PipeBCenter);
-
-    // If pipe A is inside pipe B
-    if (CenterDistance < KINDA_SMALL_NUMBER && PipeAOuterRadius <= PipeBInnerRadius)
-    {
-        return false; // Pipe A is completely inside Pipe B, no collision
-    }
+	const FTetherPipeGeometry PipeA = A->GetGeometry();
+	const FTetherPipeGeometry PipeB = B->GetGeometry();
 
-    // If pipe B is inside pipe A
-    if (CenterDistance < KINDA_SMALL_NUMBER && PipeBOuterRadius <= PipeAInnerRadius)
-    {
-        return false; // Pipe B is completely inside Pipe A, no collision
-    }
-
-    // Increase the number of segments for a finer approximation of the arc
-    int32 NumSegmentsA = FMath::Max(24, FMath::RoundToInt(PipeAArcAngle / 2.f));  // More segments for better accuracy
-    int32 NumSegmentsB = FMath::Max(24, FMath::RoundToInt(PipeBArcAngle / 2.f));
-
-    float AngleStepA = PipeAArcAngle / NumSegmentsA;
-    float AngleStepB = PipeBArcAngle / NumSegmentsB;
-
-    float ClosestDistanceSquared = FLT_MAX;
-    FVector ClosestPointA, ClosestPointB;
-
-    // Iterate through points along the arcs of both pipes
-    for (int32 i = 0; i < NumSegmentsA; ++i)
-    {
-        float AngleA = FMath::DegreesToRadians(i * AngleStepA);
-
-        // Calculate points for both the outer and inner radii of Pipe A
-        FVector OuterPointA = PipeACenter + PipeARotation.RotateVector(FVector(PipeAOuterRadius * FMath::Cos(AngleA), PipeAOuterRadius * FMath::Sin(AngleA), 0.0f));
-        FVector InnerPointA = PipeACenter + PipeARotation.RotateVector(FVector(PipeAInnerRadius * FMath::Cos(AngleA), PipeAInnerRadius * FMath::Sin(AngleA), 0.0f));
-
-        for (int32 j = 0; j < NumSegmentsB; ++j)
-        {
-            float AngleB = FMath::DegreesToRadians(j * AngleStepB);
-
-            // Calculate points for both the outer and inner radii of Pipe B
-            FVector OuterPointB = PipeBCenter + PipeBRotation.RotateVector(FVector(PipeBOuterRadius * FMath::Cos(AngleB), PipeBOuterRadius * FMath::Sin(AngleB), 0.0f));
-            FVector InnerPointB = PipeBCenter + PipeBRotation.RotateVector(FVector(PipeBInnerRadius * FMath::Cos(AngleB), PipeBInnerRadius * FMath::Sin(AngleB), 0.0f));
-
-            // Check the outer points of both pipes
-            float DistanceSquaredOuter = FVector::DistSquared(OuterPointA, OuterPointB);
-
-            if (DistanceSquaredOuter < ClosestDistanceSquared)
-            {
-                ClosestDistanceSquared = DistanceSquaredOuter;
-                ClosestPointA = OuterPointA;
-                ClosestPointB = OuterPointB;
-            }
-
-            // Check the inner points (if needed)
-            if (PipeAInnerRadius > 0.0f && PipeBInnerRadius > 0.0f)
-            {
-                float DistanceSquaredInner = FVector::DistSquared(InnerPointA, InnerPointB);
-
-                if (DistanceSquaredInner < ClosestDistanceSquared)
-                {
-                    ClosestDistanceSquared = DistanceSquaredInner;
-                    ClosestPointA = InnerPointA;
-                    ClosestPointB = InnerPointB;
-                }
-            }
-        }
-    }
+	const auto ProjectOnB = [&PipeB](const FVector& Point, bool& bOutInside)
+	{
+		return PipeB.GetClosestPoint(Point, bOutInside);
+	};
 
-    // Check if the closest points are within the combined thickness of the pipes
-    float CombinedThickness = PipeAThickness + PipeBThickness;
-    if (ClosestDistanceSquared <= FMath::Square(CombinedThickness))
-    {
-        float ClosestDistance = FMath::Sqrt(ClosestDistanceSquared);
+	// Pipes are usually rings, so the contact can be far from either center (e.g. interlocking links)
+	// Seed from both centers and keep whichever finds an overlap
+	for (const FVector& Seed : { B->Center, A->Center })
+	{
+		FVector PointOnA, PointOnB;
+		if (!FTetherPipePrivate::FindClosestPoints(PipeA, Seed, ProjectOnB, PointOnA, PointOnB))
+		{
+			continue;
+		}
 
-        // Calculate the contact point and penetration depth
-        Output.ContactPoint = (ClosestPointA + ClosestPointB) * 0.5f;
-        Output.PenetrationDepth = CombinedThickness - ClosestDistance;
+		// The point is inside both pipes, push out through whichever nearest face is shallower
+		FVector NormalA, NormalB;
+		const float DepthA = PipeA.GetPenetration(PointOnA, NormalA);
+		const float DepthB = PipeB.GetPenetration(PointOnA, NormalB);
 
-        // Calculate the contact normal (direction of penetration)
-        if (ClosestDistance > KINDA_SMALL_NUMBER)
-        {
-            Output.ContactNormal = (ClosestPointB - ClosestPointA).GetSafeNormal();
-        }
-        else
-        {
-            Output.ContactNormal = FVector::ZeroVector; // If perfectly overlapping
-        }
+		Output.ContactPoint = PointOnA;
+		Output.PenetrationDepth = FMath::Min(DepthA, DepthB);
 
-        return true;
-    }
+		// The normal points from A to B
+		Output.ContactNormal = DepthA <= DepthB ? NormalA : -NormalB;
+		return true;
+	}
 
-    return false;
+	return false;
 }
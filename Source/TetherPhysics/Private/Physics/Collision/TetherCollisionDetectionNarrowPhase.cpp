@@ -6,6 +6,9 @@
 #include "TetherIO.h"
 #include "TetherStatics.h"
 #include "Physics/Collision/TetherCollisionDetectionHandler.h"
+#include "Shapes/TetherShape_BoundingSphere.h"
+#include "Shapes/TetherShape_Capsule.h"
+#include "Shapes/TetherShape_Compound.h"
 #include "System/TetherDrawing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherCollisionDetectionNarrowPhase)
@@ -13,6 +16,8 @@
 namespace FTether
 {
 	TAutoConsoleVariable<bool> CVarTetherLogNarrowPhaseCollision(TEXT("p.Tether.NarrowPhase.Log"), false, TEXT("Log Tether Narrow-Phase collisions"));
+	TAutoConsoleVariable<bool> CVarTetherNarrowPhaseBatch(TEXT("p.Tether.NarrowPhase.Batch"), true, TEXT("Test sphere and capsule pairs in vectorized batches instead of one at a time"));
+	TAutoConsoleVariable<bool> CVarTetherNarrowPhaseForceGJK(TEXT("p.Tether.NarrowPhase.ForceGJK"), false, TEXT("Test every non-batched pair with GJK instead of its dedicated routine, as a baseline for comparison"));
 
 #if ENABLE_DRAW_DEBUG
 	TAutoConsoleVariable<bool> CVarTetherDrawNarrowPhaseCollision(TEXT("p.Tether.NarrowPhase.Draw"), false, TEXT("Draw Tether Narrow-Phase collisions"));
@@ -28,49 +33,162 @@ void UTetherCollisionDetectionNarrowPhase::DetectCollision(const FTetherIO* Inpu
 	// Clear the output before starting
 	Output->Collisions.Reset();
 
+	const TArray<FTetherShapePair>& Pairings = *Input->CollisionPairings;
+	FTetherNarrowPhaseBatches& Batches = Output->Batches;
+	Batches.Reset();
 
-	// Iterate through each collision pairing from the broad-phase
-	for (const FTetherShapePair& Pair : *Input->CollisionPairings)
+	// Shared handling for every detected collision, regardless of which path found it
+	auto OnCollision = [Input, Output, WorldTime](const FTetherShapePair& Pair, FNarrowPhaseCollision& CollisionEntry)
 	{
-		// Perform narrow-phase collision check between ShapeA and ShapeB
-		FNarrowPhaseCollision CollisionEntry { Pair.ShapeA, Pair.ShapeB };
-		if (CollisionDetectionHandler->CheckNarrowCollision(Pair.ShapeA, Pair.ShapeB, CollisionEntry))
+		// Linear Output
+		const FLinearOutput* LinearA = Input->LinearOutputs[Pair.IndexA];
+		const FLinearOutput* LinearB = Input->LinearOutputs[Pair.IndexB];
+
+		// Angular Output
+		const FAngularOutput* AngularA = Input->AngularOutputs[Pair.IndexA];
+		const FAngularOutput* AngularB = Input->AngularOutputs[Pair.IndexB];
+
+		// Get Velocity at Point
+		const FVector ContactVelocityA = UTetherStatics::GetVelocityAtPoint(CollisionEntry.ContactPoint,
+			Pair.ShapeA->GetLocalSpaceCenter(), LinearA->LinearVelocity, AngularA->AngularVelocity);
+		
+		const FVector ContactVelocityB = UTetherStatics::GetVelocityAtPoint(CollisionEntry.ContactPoint,
+			Pair.ShapeB->GetLocalSpaceCenter(), LinearB->LinearVelocity, AngularB->AngularVelocity);
+		
+		// Calculate relative velocity at the contact point
+		CollisionEntry.RelativeVelocity = ContactVelocityA - ContactVelocityB;
+
+		// Fall back to the direction from the center of A to the center of B if the routine didn't provide a normal
+		if (CollisionEntry.ContactNormal.IsNearlyZero())
 		{
-			// Linear Output
-			const FLinearOutput* const& LinearA = Input->LinearOutputs[Pair.ShapeA];
-			const FLinearOutput* const& LinearB = Input->LinearOutputs[Pair.ShapeB];
-
-			// Angular Output
-			const FAngularOutput* const& AngularA = Input->AngularOutputs[Pair.ShapeA];
-			const FAngularOutput* const& AngularB = Input->AngularOutputs[Pair.ShapeB];
-
-			// Get Velocity at Point
-			const FVector ContactVelocityA = UTetherStatics::GetVelocityAtPoint(CollisionEntry.ContactPoint,
-				Pair.ShapeA->GetLocalSpaceCenter(), LinearA->LinearVelocity, AngularA->AngularVelocity);
-			
-			const FVector ContactVelocityB = UTetherStatics::GetVelocityAtPoint(CollisionEntry.ContactPoint,
-				Pair.ShapeB->GetLocalSpaceCenter(), LinearB->LinearVelocity, AngularB->AngularVelocity);
-			
-			// Calculate relative velocity at the contact point
-			CollisionEntry.RelativeVelocity = ContactVelocityA - ContactVelocityB;
-
-			// Calculate the vector from the center of A to the center of B
-			FVector CollisionVector = Pair.ShapeB->GetLocalSpaceCenter() - Pair.ShapeA->GetLocalSpaceCenter();
-			
-			// Normalize the collision vector to get the contact normal
+			const FVector CollisionVector = Pair.ShapeB->GetLocalSpaceCenter() - Pair.ShapeA->GetLocalSpaceCenter();
 			CollisionEntry.ContactNormal = CollisionVector.GetSafeNormal();
+		}
+
+		// Add the collision entry to the output
+		Output->Collisions.Add(CollisionEntry);
+
+		// Track contact state and carry per-pair data forward
+		if (Input->PairCache)
+		{
+			Input->PairCache->AddNarrowPhaseContact(Pair, CollisionEntry, WorldTime);
+		}
+
+		// Debug logging
+		if (FTether::CVarTetherLogNarrowPhaseCollision.GetValueOnAnyThread())
+		{
+			UE_LOG(LogTether, Warning, TEXT("[ %s ] Shape { %s } narrow-phase collision with { %s } at Contact Point { %s }, Penetration Depth: { %.3f }"),
+				*FString(__FUNCTION__), *Pair.ShapeA->GetName(), *Pair.ShapeB->GetName(), *CollisionEntry.ContactPoint.ToString(), CollisionEntry.PenetrationDepth);
+		}
+	};
+
+	// Bucket the pairs by shape type, sphere and capsule pairs are packed for the vectorized kernels
+	static const uint8 SphereId = FTetherShapeTypeRegistry::GetShapeTypeId(FTetherShape_BoundingSphere::StaticShapeType());
+	static const uint8 CapsuleId = FTetherShapeTypeRegistry::GetShapeTypeId(FTetherShape_Capsule::StaticShapeType());
+
+	// A handler subclass may have overridden CheckNarrowCollision(), only bypass it for the native handler
+	const bool bNativeHandler = CollisionDetectionHandler->GetClass() == UTetherCollisionDetectionHandler::StaticClass();
+	const bool bBatch = bNativeHandler && FTether::CVarTetherNarrowPhaseBatch.GetValueOnAnyThread();
+
+	for (int32 PairIndex = 0; PairIndex < Pairings.Num(); PairIndex++)
+	{
+		const FTetherShapePair& Pair = Pairings[PairIndex];
+		const uint8 TypeA = Pair.ShapeA->GetShapeTypeId();
+		const uint8 TypeB = Pair.ShapeB->GetShapeTypeId();
+
+		if (bBatch && TypeA == SphereId && TypeB == SphereId)
+		{
+			const auto* A = static_cast<const FTetherShape_BoundingSphere*>(Pair.ShapeA);
+			const auto* B = static_cast<const FTetherShape_BoundingSphere*>(Pair.ShapeB);
+			Batches.SphereSphere.Add(PairIndex, A->Center, A->Radius, B->Center, B->Radius);
+		}
+		else if (bBatch && ((TypeA == SphereId && TypeB == CapsuleId) || (TypeA == CapsuleId && TypeB == SphereId)))
+		{
+			// The contact point is symmetric, so the sphere can always be packed first
+			const bool bSphereFirst = TypeA == SphereId;
+			const auto* Sphere = static_cast<const FTetherShape_BoundingSphere*>(bSphereFirst ? Pair.ShapeA : Pair.ShapeB);
+			const auto* Capsule = static_cast<const FTetherShape_Capsule*>(bSphereFirst ? Pair.ShapeB : Pair.ShapeA);
+
+			FVector Bottom, Top;
+			Capsule->GetSegment(Bottom, Top);
+			Batches.SphereCapsule.Add(PairIndex, Sphere->Center, Sphere->Radius, Bottom, Top, Capsule->Radius);
+		}
+		else if (bBatch && TypeA == CapsuleId && TypeB == CapsuleId)
+		{
+			const auto* A = static_cast<const FTetherShape_Capsule*>(Pair.ShapeA);
+			const auto* B = static_cast<const FTetherShape_Capsule*>(Pair.ShapeB);
+
+			FVector BottomA, TopA, BottomB, TopB;
+			A->GetSegment(BottomA, TopA);
+			B->GetSegment(BottomB, TopB);
+			Batches.CapsuleCapsule.Add(PairIndex, A->Center, BottomA, TopA, A->Radius, BottomB, TopB, B->Radius);
+		}
+		else
+		{
+			const uint64 TypeKey = static_cast<uint64>(TypeA) << 8 | TypeB;
+			Batches.ScalarPairs.Add(TypeKey << 32 | static_cast<uint32>(PairIndex));
+		}
+	}
+
+	// Run the vectorized kernels and emit their hits
+	for (FTetherNarrowPhaseBatch* Batch : { static_cast<FTetherNarrowPhaseBatch*>(&Batches.SphereSphere),
+		static_cast<FTetherNarrowPhaseBatch*>(&Batches.SphereCapsule), static_cast<FTetherNarrowPhaseBatch*>(&Batches.CapsuleCapsule) })
+	{
+		if (Batch->Num() == 0)
+		{
+			continue;
+		}
 
-			// Add the collision entry to the output
-			Output->Collisions.Add(CollisionEntry);
+		Batch->Solve();
 
-			// Debug logging
-			if (FTether::CVarTetherLogNarrowPhaseCollision.GetValueOnAnyThread())
+		for (int32 i = 0; i < Batch->Num(); i++)
+		{
+			if (Batch->IsHit(i))
 			{
-				UE_LOG(LogTether, Warning, TEXT("[ %s ] Shape { %s } narrow-phase collision with { %s } at Contact Point { %s }, Penetration Depth: { %.3f }"),
-					*FString(__FUNCTION__), *Pair.ShapeA->GetName(), *Pair.ShapeB->GetName(), *CollisionEntry.ContactPoint.ToString(), CollisionEntry.PenetrationDepth);
+				const FTetherShapePair& Pair = Pairings[Batch->PairIndices[i]];
+				FNarrowPhaseCollision CollisionEntry { Pair.ShapeA, Pair.ShapeB };
+				CollisionEntry.ContactPoint = Batch->GetContactPoint(i);
+				CollisionEntry.PenetrationDepth = Batch->PenetrationDepth[i];
+				OnCollision(Pair, CollisionEntry);
 			}
 		}
 	}
+
+	// Remaining pairs go through the dispatch table, sorted so each type pair runs back to back
+	// Pairs without a dedicated routine use GJK, warm started from the simplex kept on their pair cache entry
+	// Compounds always go through the dispatch, which descends to their children, as do all pairs of a handler subclass
+	const bool bForceGJK = FTether::CVarTetherNarrowPhaseForceGJK.GetValueOnAnyThread();
+	Batches.ScalarPairs.Sort();
+	for (const uint64 Key : Batches.ScalarPairs)
+	{
+		const FTetherShapePair& Pair = Pairings[static_cast<int32>(Key & MAX_uint32)];
+
+		// Perform narrow-phase collision check between ShapeA and ShapeB
+		FNarrowPhaseCollision CollisionEntry { Pair.ShapeA, Pair.ShapeB };
+		const bool bCompound = FTetherShape_Compound::IsCompound(*Pair.ShapeA) || FTetherShape_Compound::IsCompound(*Pair.ShapeB);
+		bool bCollision;
+		if (bNativeHandler && !bCompound && (bForceGJK || !UTetherCollisionDetectionHandler::HasNarrowCollision(Pair.ShapeA->GetShapeTypeId(), Pair.ShapeB->GetShapeTypeId())))
+		{
+			FTetherPairCacheEntry* Entry = Input->PairCache ? Input->PairCache->Entries.Find(Pair) : nullptr;
+			bCollision = CollisionDetectionHandler->CheckNarrowCollisionConvex(Pair.ShapeA, Pair.ShapeB, CollisionEntry,
+				Entry ? &Entry->Simplex : nullptr);
+		}
+		else
+		{
+			bCollision = CollisionDetectionHandler->CheckNarrowCollision(Pair.ShapeA, Pair.ShapeB, CollisionEntry);
+		}
+
+		if (bCollision)
+		{
+			OnCollision(Pair, CollisionEntry);
+		}
+	}
+
+	// End any contacts that were not found this tick
+	if (Input->PairCache)
+	{
+		Input->PairCache->EndNarrowPhase();
+	}
 }
 
 void UTetherCollisionDetectionNarrowPhase::DrawDebug(const TArray<FTetherShape*>* Shapes, const FTetherIO* InputData,
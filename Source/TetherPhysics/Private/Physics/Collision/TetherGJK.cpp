@@ -0,0 +1,509 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Collision/TetherGJK.h"
+
+#include "Shapes/TetherShape.h"
+
+namespace FTether
+{
+	/** GJK converges in a handful of iterations for smooth shapes, the limit only guards against cycling */
+	static constexpr int32 GJKMaxIterations = 32;
+
+	/** EPA adds one vertex per iteration, rounded shapes converge slowly so the limit trades accuracy for time */
+	static constexpr int32 EPAMaxIterations = 32;
+
+	/** Shapes closer than this are treated as touching */
+	static constexpr float GJKTolerance = 1e-3f;
+
+	/** GJK stops once the closest point moves less than this fraction of its squared distance */
+	static constexpr float GJKRelativeTolerance = 1e-4f;
+
+	/** EPA stops once the support point is within this distance of the closest face */
+	static constexpr float EPATolerance = 1e-2f;
+}
+
+namespace FTetherGJKPrivate
+{
+	/** Faces of a tetrahedron, the fourth index is the vertex opposite the face */
+	static constexpr int32 TetrahedronFaces[4][4] = { {0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0} };
+}
+
+FTetherGJKResult FTetherGJK::Query(const FTetherShape& A, const FTetherShape& B, FTetherGJKSimplex* Simplex,
+	bool bComputePenetration)
+{
+	FTetherGJKResult Result;
+
+	const UTetherShapeObject* ObjectA = A.GetTetherShapeObject();
+	const UTetherShapeObject* ObjectB = B.GetTetherShapeObject();
+	if (!ObjectA || !ObjectB)
+	{
+		return Result;
+	}
+
+	const auto SupportA = [&A, ObjectA](const FVector& Direction) { return ObjectA->GetSupportPoint(A, Direction); };
+	const auto SupportB = [&B, ObjectB](const FVector& Direction) { return ObjectB->GetSupportPoint(B, Direction); };
+
+	FTetherGJKVertex Vertices[4];
+	int32 NumVertices = 0;
+
+	// Warm start from the directions that supported last tick's simplex
+	if (Simplex && Simplex->NumDirections > 0 && (Simplex->ShapeA == &A || Simplex->ShapeA == &B))
+	{
+		const float Sign = Simplex->ShapeA == &A ? 1.f : -1.f;
+		for (int32 i = 0; i < Simplex->NumDirections; i++)
+		{
+			Vertices[NumVertices++] = Support(SupportA, SupportB, Simplex->Directions[i] * Sign);
+		}
+	}
+	else
+	{
+		FVector Direction = A.GetBounds().Center - B.GetBounds().Center;
+		if (Direction.IsNearlyZero())
+		{
+			Direction = FVector::ForwardVector;
+		}
+		Vertices[NumVertices++] = Support(SupportA, SupportB, Direction);
+	}
+
+	Iterate(SupportA, SupportB, Vertices, NumVertices, Result);
+
+	if (Simplex)
+	{
+		Simplex->NumDirections = NumVertices;
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			Simplex->Directions[i] = Vertices[i].Direction;
+		}
+		Simplex->ShapeA = &A;
+		Simplex->LastIterations = Result.Iterations;
+	}
+
+	if (Result.bOverlap && bComputePenetration)
+	{
+		SolveEPA(SupportA, SupportB, Vertices, NumVertices, Result);
+	}
+	return Result;
+}
+
+FTetherGJKResult FTetherGJK::Query(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB,
+	const FVector& InitialDirection, bool bComputePenetration)
+{
+	FTetherGJKResult Result;
+
+	FTetherGJKVertex Vertices[4];
+	int32 NumVertices = 0;
+	Vertices[NumVertices++] = Support(SupportA, SupportB,
+		InitialDirection.IsNearlyZero() ? FVector::ForwardVector : InitialDirection);
+
+	Iterate(SupportA, SupportB, Vertices, NumVertices, Result);
+
+	if (Result.bOverlap && bComputePenetration)
+	{
+		SolveEPA(SupportA, SupportB, Vertices, NumVertices, Result);
+	}
+	return Result;
+}
+
+void FTetherGJK::Iterate(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB, FTetherGJKVertex* Vertices,
+	int32& NumVertices, FTetherGJKResult& Result)
+{
+	float Weights[4] = { 1.f, 0.f, 0.f, 0.f };
+	FVector Closest = FVector::ZeroVector;
+	bool bConverged = false;
+	while (!bConverged && Result.Iterations < FTether::GJKMaxIterations)
+	{
+		Result.Iterations++;
+
+		Closest = ReduceSimplex(Vertices, NumVertices, Weights);
+		const float DistanceSquared = Closest.SizeSquared();
+		if (NumVertices == 4 || DistanceSquared <= FMath::Square(FTether::GJKTolerance))
+		{
+			Result.bOverlap = true;
+			break;
+		}
+
+		// Stop once the Minkowski difference extends no further towards the origin
+		const FTetherGJKVertex Vertex = Support(SupportA, SupportB, -Closest);
+		bConverged = DistanceSquared - (Closest | Vertex.Point) <= FTether::GJKRelativeTolerance * DistanceSquared;
+
+		// A repeated vertex means no progress either, the simplex can't improve on Closest
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			bConverged |= Vertices[i].Point.Equals(Vertex.Point, FTether::GJKTolerance);
+		}
+
+		if (!bConverged)
+		{
+			Vertices[NumVertices++] = Vertex;
+		}
+	}
+
+	// Out of iterations, reduce the vertex added last so the weights match the simplex
+	if (!bConverged && !Result.bOverlap)
+	{
+		Closest = ReduceSimplex(Vertices, NumVertices, Weights);
+		Result.bOverlap = NumVertices == 4 || Closest.SizeSquared() <= FMath::Square(FTether::GJKTolerance);
+	}
+
+	if (!Result.bOverlap)
+	{
+		// Closest is PointA - PointB, interpolated from the supporting vertices
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			Result.PointA += Vertices[i].SupportA * Weights[i];
+			Result.PointB += Vertices[i].SupportB * Weights[i];
+		}
+		Result.Distance = Closest.Size();
+		Result.Normal = Result.Distance > UE_SMALL_NUMBER ? -Closest / Result.Distance : FVector::ZeroVector;
+	}
+}
+
+FTetherGJKVertex FTetherGJK::Support(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB,
+	const FVector& Direction)
+{
+	FTetherGJKVertex Vertex;
+	Vertex.Direction = Direction;
+	Vertex.SupportA = SupportA(Direction);
+	Vertex.SupportB = SupportB(-Direction);
+	Vertex.Point = Vertex.SupportA - Vertex.SupportB;
+	return Vertex;
+}
+
+FVector FTetherGJK::ReduceSimplex(FTetherGJKVertex* Vertices, int32& NumVertices, float* Weights)
+{
+	switch (NumVertices)
+	{
+	case 1:
+	{
+		Weights[0] = 1.f;
+		return Vertices[0].Point;
+	}
+	case 2:
+	{
+		const FVector& PointA = Vertices[0].Point;
+		const FVector Segment = Vertices[1].Point - PointA;
+		const float LengthSquared = Segment.SizeSquared();
+		const float T = LengthSquared > UE_SMALL_NUMBER ? FMath::Clamp<float>(-(PointA | Segment) / LengthSquared, 0.f, 1.f) : 0.f;
+		if (T <= 0.f)
+		{
+			NumVertices = 1;
+			Weights[0] = 1.f;
+			return PointA;
+		}
+		if (T >= 1.f)
+		{
+			Vertices[0] = Vertices[1];
+			NumVertices = 1;
+			Weights[0] = 1.f;
+			return Vertices[0].Point;
+		}
+		Weights[0] = 1.f - T;
+		Weights[1] = T;
+		return PointA + Segment * T;
+	}
+	case 3:
+	{
+		const FTetherGJKVertex Triangle[3] = { Vertices[0], Vertices[1], Vertices[2] };
+		return ReduceTriangle(Triangle[0], Triangle[1], Triangle[2], Vertices, NumVertices, Weights);
+	}
+	default:
+	{
+		const FTetherGJKVertex Tetrahedron[4] = { Vertices[0], Vertices[1], Vertices[2], Vertices[3] };
+		const FVector Edge1 = Tetrahedron[1].Point - Tetrahedron[0].Point;
+		const FVector Edge2 = Tetrahedron[2].Point - Tetrahedron[0].Point;
+		const FVector Edge3 = Tetrahedron[3].Point - Tetrahedron[0].Point;
+		const bool bDegenerate = FMath::Abs((Edge1 ^ Edge2) | Edge3) <= UE_KINDA_SMALL_NUMBER;
+
+		// Only faces with the origin on the far side from the opposite vertex can hold the closest point
+		FVector Best = FVector::ZeroVector;
+		float BestDistanceSquared = TNumericLimits<float>::Max();
+		bool bOutside = false;
+		for (const int32 (&Face)[4] : FTetherGJKPrivate::TetrahedronFaces)
+		{
+			const FVector& PointA = Tetrahedron[Face[0]].Point;
+			const FVector Normal = (Tetrahedron[Face[1]].Point - PointA) ^ (Tetrahedron[Face[2]].Point - PointA);
+			const float OriginSide = Normal | -PointA;
+			const float OppositeSide = Normal | (Tetrahedron[Face[3]].Point - PointA);
+			if (!bDegenerate && OriginSide * OppositeSide >= 0.f)
+			{
+				continue;
+			}
+			bOutside = true;
+
+			FTetherGJKVertex FaceVertices[3];
+			float FaceWeights[3];
+			int32 NumFaceVertices = 0;
+			const FVector Closest = ReduceTriangle(Tetrahedron[Face[0]], Tetrahedron[Face[1]], Tetrahedron[Face[2]],
+				FaceVertices, NumFaceVertices, FaceWeights);
+
+			const float DistanceSquared = Closest.SizeSquared();
+			if (DistanceSquared < BestDistanceSquared)
+			{
+				BestDistanceSquared = DistanceSquared;
+				Best = Closest;
+				NumVertices = NumFaceVertices;
+				for (int32 i = 0; i < NumFaceVertices; i++)
+				{
+					Vertices[i] = FaceVertices[i];
+					Weights[i] = FaceWeights[i];
+				}
+			}
+		}
+
+		// The origin is inside the tetrahedron
+		if (!bOutside)
+		{
+			NumVertices = 4;
+			return FVector::ZeroVector;
+		}
+		return Best;
+	}
+	}
+}
+
+FVector FTetherGJK::ReduceTriangle(const FTetherGJKVertex& A, const FTetherGJKVertex& B, const FTetherGJKVertex& C,
+	FTetherGJKVertex* OutVertices, int32& OutNumVertices, float* OutWeights)
+{
+	// Voronoi region tests for the closest point to the origin, Ericson's Real-Time Collision Detection 5.1.5
+	const auto SetVertex = [OutVertices, &OutNumVertices, OutWeights](const FTetherGJKVertex& Vertex)
+	{
+		OutVertices[0] = Vertex;
+		OutWeights[0] = 1.f;
+		OutNumVertices = 1;
+		return Vertex.Point;
+	};
+
+	const auto SetEdge = [OutVertices, &OutNumVertices, OutWeights](const FTetherGJKVertex& From,
+		const FTetherGJKVertex& To, float T)
+	{
+		OutVertices[0] = From;
+		OutVertices[1] = To;
+		OutWeights[0] = 1.f - T;
+		OutWeights[1] = T;
+		OutNumVertices = 2;
+		return From.Point + (To.Point - From.Point) * T;
+	};
+
+	const FVector AB = B.Point - A.Point;
+	const FVector AC = C.Point - A.Point;
+
+	const float D1 = AB | -A.Point;
+	const float D2 = AC | -A.Point;
+	if (D1 <= 0.f && D2 <= 0.f)
+	{
+		return SetVertex(A);
+	}
+
+	const float D3 = AB | -B.Point;
+	const float D4 = AC | -B.Point;
+	if (D3 >= 0.f && D4 <= D3)
+	{
+		return SetVertex(B);
+	}
+
+	const float VC = D1 * D4 - D3 * D2;
+	if (VC <= 0.f && D1 >= 0.f && D3 <= 0.f)
+	{
+		return SetEdge(A, B, D1 / FMath::Max(D1 - D3, UE_SMALL_NUMBER));
+	}
+
+	const float D5 = AB | -C.Point;
+	const float D6 = AC | -C.Point;
+	if (D6 >= 0.f && D5 <= D6)
+	{
+		return SetVertex(C);
+	}
+
+	const float VB = D5 * D2 - D1 * D6;
+	if (VB <= 0.f && D2 >= 0.f && D6 <= 0.f)
+	{
+		return SetEdge(A, C, D2 / FMath::Max(D2 - D6, UE_SMALL_NUMBER));
+	}
+
+	const float VA = D3 * D6 - D5 * D4;
+	if (VA <= 0.f && (D4 - D3) >= 0.f && (D5 - D6) >= 0.f)
+	{
+		return SetEdge(B, C, (D4 - D3) / FMath::Max((D4 - D3) + (D5 - D6), UE_SMALL_NUMBER));
+	}
+
+	// Inside the face
+	const float Sum = VA + VB + VC;
+	if (Sum <= UE_SMALL_NUMBER)
+	{
+		return SetVertex(A);
+	}
+	const float V = VB / Sum;
+	const float W = VC / Sum;
+	OutVertices[0] = A;
+	OutVertices[1] = B;
+	OutVertices[2] = C;
+	OutWeights[0] = 1.f - V - W;
+	OutWeights[1] = V;
+	OutWeights[2] = W;
+	OutNumVertices = 3;
+	return A.Point + AB * V + AC * W;
+}
+
+void FTetherGJK::SolveEPA(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB, FTetherGJKVertex* Vertices,
+	int32 NumVertices, FTetherGJKResult& Result)
+{
+	// Touching or shallow overlaps end GJK early with fewer than four vertices, grow the simplex into a tetrahedron
+	static const FVector Axes[6] =
+	{
+		FVector::ForwardVector, FVector::BackwardVector, FVector::RightVector,
+		FVector::LeftVector, FVector::UpVector, FVector::DownVector
+	};
+
+	if (NumVertices == 1)
+	{
+		for (const FVector& Axis : Axes)
+		{
+			const FTetherGJKVertex Vertex = Support(SupportA, SupportB, Axis);
+			if (!Vertex.Point.Equals(Vertices[0].Point, FTether::GJKTolerance))
+			{
+				Vertices[NumVertices++] = Vertex;
+				break;
+			}
+		}
+	}
+
+	if (NumVertices == 2)
+	{
+		const FVector Segment = Vertices[1].Point - Vertices[0].Point;
+		for (const FVector& Axis : Axes)
+		{
+			const FVector Direction = Segment ^ Axis;
+			if (Direction.IsNearlyZero())
+			{
+				continue;
+			}
+			const FTetherGJKVertex Vertex = Support(SupportA, SupportB, Direction);
+			if (!((Vertex.Point - Vertices[0].Point) ^ Segment).IsNearlyZero())
+			{
+				Vertices[NumVertices++] = Vertex;
+				break;
+			}
+		}
+	}
+
+	if (NumVertices == 3)
+	{
+		const FVector Normal = (Vertices[1].Point - Vertices[0].Point) ^ (Vertices[2].Point - Vertices[0].Point);
+		FTetherGJKVertex Vertex = Support(SupportA, SupportB, Normal);
+		if (FMath::Abs((Vertex.Point - Vertices[0].Point) | Normal) <= UE_KINDA_SMALL_NUMBER)
+		{
+			Vertex = Support(SupportA, SupportB, -Normal);
+		}
+		Vertices[NumVertices++] = Vertex;
+	}
+
+	// Flat shapes can't form a tetrahedron, they only touch
+	if (NumVertices < 4 || FMath::Abs(((Vertices[1].Point - Vertices[0].Point) ^ (Vertices[2].Point - Vertices[0].Point)) |
+		(Vertices[3].Point - Vertices[0].Point)) <= UE_KINDA_SMALL_NUMBER)
+	{
+		Result.PointA = Vertices[0].SupportA;
+		Result.PointB = Vertices[0].SupportB;
+		return;
+	}
+
+	struct FFace
+	{
+		int32 Indices[3];
+		FVector Normal;
+		float Distance;
+	};
+
+	TArray<FTetherGJKVertex, TInlineAllocator<64>> Points(Vertices, 4);
+	TArray<FFace, TInlineAllocator<128>> Faces;
+	TArray<TPair<int32, int32>, TInlineAllocator<32>> Horizon;
+
+	const auto AddFace = [&Points, &Faces](int32 IndexA, int32 IndexB, int32 IndexC)
+	{
+		const FVector& PointA = Points[IndexA].Point;
+		FVector Normal = (Points[IndexB].Point - PointA) ^ (Points[IndexC].Point - PointA);
+		if (Normal.Normalize(UE_SMALL_NUMBER))
+		{
+			Faces.Add({ { IndexA, IndexB, IndexC }, Normal, static_cast<float>(Normal | PointA) });
+		}
+	};
+
+	// Wind the initial faces so their normals point away from the opposite vertex, and so away from the origin
+	for (const int32 (&Face)[4] : FTetherGJKPrivate::TetrahedronFaces)
+	{
+		const FVector& PointA = Points[Face[0]].Point;
+		const FVector Normal = (Points[Face[1]].Point - PointA) ^ (Points[Face[2]].Point - PointA);
+		if ((Normal | (Points[Face[3]].Point - PointA)) > 0.f)
+		{
+			AddFace(Face[0], Face[2], Face[1]);
+		}
+		else
+		{
+			AddFace(Face[0], Face[1], Face[2]);
+		}
+	}
+
+	FFace Closest = Faces.Num() > 0 ? Faces[0] : FFace { { 0, 0, 0 }, FVector::ZeroVector, 0.f };
+	for (int32 Iteration = 0; Iteration < FTether::EPAMaxIterations && Faces.Num() > 0; Iteration++)
+	{
+		Closest = Faces[0];
+		for (const FFace& Face : Faces)
+		{
+			if (Face.Distance < Closest.Distance)
+			{
+				Closest = Face;
+			}
+		}
+
+		// Converged once the polytope can't be pushed further out along the closest face
+		const FTetherGJKVertex Vertex = Support(SupportA, SupportB, Closest.Normal);
+		if ((Vertex.Point | Closest.Normal) - Closest.Distance <= FTether::EPATolerance)
+		{
+			break;
+		}
+
+		// Remove every face the new vertex can see, the edges they don't share form the horizon
+		const int32 NewIndex = Points.Add(Vertex);
+		Horizon.Reset();
+		for (int32 i = Faces.Num() - 1; i >= 0; i--)
+		{
+			const FFace& Face = Faces[i];
+			if ((Face.Normal | (Vertex.Point - Points[Face.Indices[0]].Point)) <= 0.f)
+			{
+				continue;
+			}
+
+			for (int32 Edge = 0; Edge < 3; Edge++)
+			{
+				const int32 From = Face.Indices[Edge];
+				const int32 To = Face.Indices[(Edge + 1) % 3];
+				const int32 Shared = Horizon.IndexOfByKey(TPair<int32, int32>(To, From));
+				if (Shared != INDEX_NONE)
+				{
+					Horizon.RemoveAtSwap(Shared);
+				}
+				else
+				{
+					Horizon.Emplace(From, To);
+				}
+			}
+			Faces.RemoveAtSwap(i);
+		}
+
+		for (const TPair<int32, int32>& Edge : Horizon)
+		{
+			AddFace(Edge.Key, Edge.Value, NewIndex);
+		}
+	}
+
+	// The normal points from A to B, the origin's projection onto the face gives the deepest points on each shape
+	Result.Normal = Closest.Normal;
+	Result.PenetrationDepth = FMath::Max(0.f, Closest.Distance);
+
+	const FTetherGJKVertex& VertexA = Points[Closest.Indices[0]];
+	const FTetherGJKVertex& VertexB = Points[Closest.Indices[1]];
+	const FTetherGJKVertex& VertexC = Points[Closest.Indices[2]];
+	const FVector Barycentric = FMath::ComputeBaryCentric2D(Closest.Normal * Closest.Distance, VertexA.Point, VertexB.Point, VertexC.Point);
+	Result.PointA = VertexA.SupportA * Barycentric.X + VertexB.SupportA * Barycentric.Y + VertexC.SupportA * Barycentric.Z;
+	Result.PointB = VertexA.SupportB * Barycentric.X + VertexB.SupportB * Barycentric.Y + VertexC.SupportB * Barycentric.Z;
+}
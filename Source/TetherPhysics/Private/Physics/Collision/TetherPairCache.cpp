@@ -0,0 +1,150 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Collision/TetherPairCache.h"
+
+#include "TetherIO.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherPairCache)
+
+void FTetherPairCache::BeginBroadPhase()
+{
+	CacheTick++;
+	BroadPhaseTestedShapes.Reset();
+	BroadPhaseOverlappingShapes.Reset();
+}
+
+FTetherPairCacheEntry* FTetherPairCache::AddBroadPhaseResult(const FTetherShapePair& Pair, bool bOverlapping)
+{
+	BroadPhaseTestedShapes.Add(Pair.ShapeA);
+	BroadPhaseTestedShapes.Add(Pair.ShapeB);
+
+	if (!bOverlapping)
+	{
+		return nullptr;
+	}
+
+	BroadPhaseOverlappingShapes.Add(Pair.ShapeA);
+	BroadPhaseOverlappingShapes.Add(Pair.ShapeB);
+
+	FTetherPairCacheEntry* Entry = Entries.Find(Pair);
+	if (!Entry)
+	{
+		Entry = &Entries.Add(Pair, FTetherPairCacheEntry(Pair));
+	}
+
+	const bool bWasOverlapping = Entry->BroadPhaseState == ETetherContactState::Begin ||
+		Entry->BroadPhaseState == ETetherContactState::Persist;
+	Entry->BroadPhaseState = bWasOverlapping ? ETetherContactState::Persist : ETetherContactState::Begin;
+	Entry->LastBroadPhaseTick = CacheTick;
+	return Entry;
+}
+
+void FTetherPairCache::EndBroadPhase()
+{
+	for (auto Itr = Entries.CreateIterator(); Itr; ++Itr)
+	{
+		FTetherPairCacheEntry& Entry = Itr.Value();
+		if (Entry.LastBroadPhaseTick == CacheTick)
+		{
+			continue;
+		}
+
+		// Ended on the previous tick, no longer needed
+		if (Entry.BroadPhaseState == ETetherContactState::End || Entry.BroadPhaseState == ETetherContactState::None)
+		{
+			Itr.RemoveCurrent();
+			continue;
+		}
+
+		// Bounds separated, so any contact has also ended
+		Entry.BroadPhaseState = ETetherContactState::End;
+		if (Entry.IsInContact())
+		{
+			Entry.NarrowPhaseState = ETetherContactState::End;
+			Entry.LastNarrowPhaseTick = CacheTick;  // Retain the End state until the next tick
+			PendingEvents.Add({ Entry, false });
+		}
+	}
+}
+
+FTetherPairCacheEntry* FTetherPairCache::AddNarrowPhaseContact(const FTetherShapePair& Pair,
+	const FNarrowPhaseCollision& Collision, double WorldTime)
+{
+	FTetherPairCacheEntry* Entry = Entries.Find(Pair);
+	if (!Entry)
+	{
+		// The narrow-phase may run without a broad-phase
+		Entry = &Entries.Add(Pair, FTetherPairCacheEntry(Pair));
+		Entry->BroadPhaseState = ETetherContactState::Begin;
+		Entry->LastBroadPhaseTick = CacheTick;
+	}
+
+	const bool bWasInContact = Entry->IsInContact();
+	Entry->PreviousPenetrationDepth = bWasInContact ? Entry->PenetrationDepth : 0.f;
+	Entry->PenetrationDepth = Collision.PenetrationDepth;
+	Entry->SeparatingAxis = Collision.ContactNormal;
+	Entry->LastNarrowPhaseTick = CacheTick;
+
+	if (bWasInContact)
+	{
+		Entry->NarrowPhaseState = ETetherContactState::Persist;
+	}
+	else
+	{
+		Entry->NarrowPhaseState = ETetherContactState::Begin;
+		Entry->BeginTime = WorldTime;
+		PendingEvents.Add({ *Entry, true });
+	}
+	return Entry;
+}
+
+void FTetherPairCache::EndNarrowPhase()
+{
+	for (auto& Itr : Entries)
+	{
+		FTetherPairCacheEntry& Entry = Itr.Value;
+		if (Entry.LastNarrowPhaseTick == CacheTick)
+		{
+			continue;
+		}
+
+		if (Entry.IsInContact())
+		{
+			Entry.NarrowPhaseState = ETetherContactState::End;
+			PendingEvents.Add({ Entry, false });
+		}
+		else if (Entry.NarrowPhaseState == ETetherContactState::End)
+		{
+			Entry.NarrowPhaseState = ETetherContactState::None;
+		}
+	}
+}
+
+void FTetherPairCache::BroadcastContactEvents()
+{
+	// Listeners may trigger another sub-tick, so take the events first
+	TArray<FTetherPendingContactEvent> Events = MoveTemp(PendingEvents);
+	PendingEvents.Reset();
+
+	for (const FTetherPendingContactEvent& Event : Events)
+	{
+		if (Event.bBegin)
+		{
+			OnContactBegin.Broadcast(Event.Entry);
+		}
+		else
+		{
+			OnContactEnd.Broadcast(Event.Entry);
+		}
+	}
+}
+
+void FTetherPairCache::Reset()
+{
+	Entries.Reset();
+	PendingEvents.Reset();
+	BroadPhaseTestedShapes.Reset();
+	BroadPhaseOverlappingShapes.Reset();
+	CacheTick = 0;
+}
@@ -3,8 +3,10 @@
 
 #include "Physics/Handlers/TetherActivityStateHandler.h"
 
+#include "TetherPhysicsTypes.h"
 #include "TetherSettings.h"
 #include "TetherStatics.h"
+#include "Physics/Solvers/TetherBodyStore.h"
 #include "System/TetherDrawing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherActivityStateHandler)
@@ -145,6 +147,52 @@ void UTetherActivityStateHandler::PostSolveSleep(FTetherShape* Shape, const FTet
 	}
 }
 
+void UTetherActivityStateHandler::SynchronizeIsland(const FTetherBodyStore& Bodies, TConstArrayView<int32> Island)
+{
+	bool bAnyAwake = false;
+	bool bAnyAsleep = false;
+	for (const int32 i : Island)
+	{
+		const FTetherShape* Shape = Bodies.Shapes[i];
+		if (Shape->SimulationMode == ETetherSimulationMode::Kinematic || Shape->ActivityState == ETetherActivityState::ForceAsleep)
+		{
+			continue;
+		}
+		bAnyAwake |= Shape->IsAwake();
+		bAnyAsleep |= Shape->IsAsleep();
+	}
+
+	if (bAnyAwake && bAnyAsleep)
+	{
+		// Part of the island is still moving, so none of it can rest yet
+		for (const int32 i : Island)
+		{
+			FTetherShape* Shape = Bodies.Shapes[i];
+			if (Shape->SimulationMode == ETetherSimulationMode::Kinematic || Shape->ActivityState != ETetherActivityState::Asleep)
+			{
+				continue;
+			}
+
+			// The partitions aren't refreshed until after the islands are solved
+			if (Bodies.Partitions[i] == ETetherBodyPartition::Awake)
+			{
+				// PostSolveSleep() put it to sleep this sub-tick, keep it awake with its elapsed timer so the island
+				// sleeps as soon as every timer has elapsed
+				Shape->ActivityState = ETetherActivityState::Awake;
+				continue;
+			}
+
+			// Asleep since a previous sub-tick, woken by the rest of the island, so it gets a fresh timer
+			if (FTether::CVarTetherActivityStateLog.GetValueOnAnyThread())
+			{
+				UE_LOG(LogTether, Warning, TEXT("{ %s } WOKE due to awake island"), *Shape->GetName());
+			}
+			Shape->ActivityState = ETetherActivityState::Awake;
+			Shape->TimeUntilSleep = Bodies.ShapeData[i]->ActivityInput.Settings.SleepDelay;
+		}
+	}
+}
+
 void UTetherActivityStateHandler::DrawDebug(FTetherShape* Shape, const FTetherIO* InputData,
 	TArray<FTetherDebugText>* PendingDebugText, float LifeTime,
 	FAnimInstanceProxy* Proxy, const UWorld* World, const FColor& WakeColor, const FColor& SleepColor,
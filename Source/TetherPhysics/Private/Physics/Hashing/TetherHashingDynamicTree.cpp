@@ -0,0 +1,403 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Hashing/TetherHashingDynamicTree.h"
+
+#include "TetherStatics.h"
+#include "System/TetherDrawing.h"
+#include "System/TetherVersioning.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherHashingDynamicTree)
+
+namespace FTether
+{
+	TAutoConsoleVariable<bool> CVarTetherLogDynamicTree(TEXT("p.Tether.DynamicTree.Log"), false, TEXT("Log Tether Dynamic Tree"));
+	TAutoConsoleVariable<bool> CVarTetherDrawDynamicTree(TEXT("p.Tether.DynamicTree.Draw"), false, TEXT("Draw Tether Dynamic Tree nodes to world"));
+}
+
+void UTetherHashingDynamicTree::Solve(const TArray<FTetherShape*>* InShapes, const FTetherIO* InputData,
+	FTetherIO* OutputData, const FTransform& Origin, float DeltaTime, double WorldTime) const
+{
+	const auto* Input = InputData->GetDataIO<FSpatialHashingInput>();
+	auto* Output = OutputData->GetDataIO<FSpatialHashingOutput>();
+	FTetherDynamicTreeData& Tree = Output->DynamicTree;
+
+	// Clear previous pairs, the tree persists
+	Output->ShapePairs.Reset();
+	Output->SpatialHashCells.Reset();
+	Output->BucketSize = FVector::ZeroVector;
+
+	const TArray<FTetherShape*>& Shapes = *InShapes;
+
+	// Detect changes to the shapes being hashed
+	bool bShapesChanged = Tree.Shapes.Num() != Shapes.Num();
+	for (int32 i = 0; i < Shapes.Num() && !bShapesChanged; i++)
+	{
+		bShapesChanged = Tree.Shapes[i] != Shapes[i];
+	}
+
+	if (bShapesChanged)
+	{
+		Tree.Reset();
+		Tree.Shapes.Append(Shapes);
+		Tree.ShapeLeaves.Init(INDEX_NONE, Shapes.Num());
+	}
+
+	// Gather the current bounds
+	Tree.ShapeBounds.Reset();
+	for (const FTetherShape* Shape : Shapes)
+	{
+		ensure(Shape->IsWorldSpace());
+		Tree.ShapeBounds.Add(Shape->GetBounds().GetBox());
+	}
+
+	// Insert new shapes, and reinsert any shape that moved outside of its enlarged bounds
+	Tree.NumReinserted = 0;
+	const float Margin = FMath::Max(0.f, Input->DynamicTreeMargin);
+	for (int32 i = 0; i < Shapes.Num(); i++)
+	{
+		const FBox& Bounds = Tree.ShapeBounds[i];
+		int32 Leaf = Tree.ShapeLeaves[i];
+		if (Leaf == INDEX_NONE)
+		{
+			Leaf = AllocateNode(Tree);
+			Tree.Nodes[Leaf].ShapeIndex = i;
+			Tree.ShapeLeaves[i] = Leaf;
+		}
+		else if (Tree.Nodes[Leaf].Bounds.IsInsideOrOn(Bounds))
+		{
+			continue;
+		}
+		else
+		{
+			RemoveLeaf(Tree, Leaf);
+			Tree.NumReinserted++;
+		}
+
+		Tree.Nodes[Leaf].Bounds = Bounds.ExpandBy(Margin);
+		InsertLeaf(Tree, Leaf);
+	}
+
+	// Query each shape's tight bounds against the enlarged leaves. Each overlapping pair is reached by both of its
+	// shapes' queries, so a query only emits leaves with a higher shape index, and each pair is added once
+	for (int32 i = 0; i < Shapes.Num(); i++)
+	{
+		const FBox& Bounds = Tree.ShapeBounds[i];
+
+		Tree.QueryStack.Reset();
+		if (Tree.Root != INDEX_NONE)
+		{
+			Tree.QueryStack.Push(Tree.Root);
+		}
+
+		while (Tree.QueryStack.Num() > 0)
+		{
+#if UE_5_04_OR_LATER
+			const FTetherDynamicTreeNode& Node = Tree.Nodes[Tree.QueryStack.Pop(EAllowShrinking::No)];
+#else
+			const FTetherDynamicTreeNode& Node = Tree.Nodes[Tree.QueryStack.Pop(false)];
+#endif
+			if (!Node.Bounds.Intersect(Bounds))
+			{
+				continue;
+			}
+
+			if (Node.IsLeaf())
+			{
+				if (Node.ShapeIndex > i && ShouldPair(Input->IgnoreMatrix, Shapes[i], Shapes[Node.ShapeIndex]))
+				{
+					Output->ShapePairs.Add(FTetherShapePair(Shapes[i], Shapes[Node.ShapeIndex]));
+				}
+			}
+			else
+			{
+				Tree.QueryStack.Push(Node.Child1);
+				Tree.QueryStack.Push(Node.Child2);
+			}
+		}
+	}
+
+	if (FTether::CVarTetherLogDynamicTree.GetValueOnAnyThread())
+	{
+		UE_LOG(LogTether, Log, TEXT("Dynamic Tree: %d shapes, %d reinserted, %d pairs, height %d%s"), Shapes.Num(),
+			Tree.NumReinserted, Output->ShapePairs.Num(),
+			Tree.Root != INDEX_NONE ? Tree.Nodes[Tree.Root].Height : 0, bShapesChanged ? TEXT(" (rebuilt)") : TEXT(""));
+	}
+}
+
+int32 UTetherHashingDynamicTree::AllocateNode(FTetherDynamicTreeData& Tree)
+{
+	if (Tree.FreeList != INDEX_NONE)
+	{
+		const int32 NodeIndex = Tree.FreeList;
+		Tree.FreeList = Tree.Nodes[NodeIndex].Parent;
+		Tree.Nodes[NodeIndex] = FTetherDynamicTreeNode();
+		return NodeIndex;
+	}
+	return Tree.Nodes.AddDefaulted();
+}
+
+void UTetherHashingDynamicTree::FreeNode(FTetherDynamicTreeData& Tree, int32 NodeIndex)
+{
+	Tree.Nodes[NodeIndex].Parent = Tree.FreeList;
+	Tree.Nodes[NodeIndex].Height = -1;
+	Tree.FreeList = NodeIndex;
+}
+
+void UTetherHashingDynamicTree::InsertLeaf(FTetherDynamicTreeData& Tree, int32 Leaf)
+{
+	if (Tree.Root == INDEX_NONE)
+	{
+		Tree.Root = Leaf;
+		Tree.Nodes[Leaf].Parent = INDEX_NONE;
+		return;
+	}
+
+	// Descend towards the sibling with the lowest surface area cost
+	const FBox LeafBounds = Tree.Nodes[Leaf].Bounds;
+	int32 Index = Tree.Root;
+	while (!Tree.Nodes[Index].IsLeaf())
+	{
+		const FTetherDynamicTreeNode& Node = Tree.Nodes[Index];
+		const float Area = GetSurfaceArea(Node.Bounds);
+		const float CombinedArea = GetSurfaceArea(Node.Bounds + LeafBounds);
+
+		// Cost of creating a new parent for this node and the new leaf
+		const float Cost = 2.f * CombinedArea;
+
+		// Minimum cost of pushing the leaf further down the tree
+		const float InheritanceCost = 2.f * (CombinedArea - Area);
+
+		auto GetDescendCost = [&Tree, &LeafBounds, InheritanceCost](int32 Child)
+		{
+			const FTetherDynamicTreeNode& ChildNode = Tree.Nodes[Child];
+			const float ChildCost = GetSurfaceArea(ChildNode.Bounds + LeafBounds);
+			return (ChildNode.IsLeaf() ? ChildCost : ChildCost - GetSurfaceArea(ChildNode.Bounds)) + InheritanceCost;
+		};
+
+		const float Cost1 = GetDescendCost(Node.Child1);
+		const float Cost2 = GetDescendCost(Node.Child2);
+
+		if (Cost < Cost1 && Cost < Cost2)
+		{
+			break;
+		}
+
+		Index = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+	}
+
+	// Create a new parent for the sibling and the leaf, allocation may reallocate Nodes so no references are held
+	const int32 Sibling = Index;
+	const int32 OldParent = Tree.Nodes[Sibling].Parent;
+	const int32 NewParent = AllocateNode(Tree);
+	Tree.Nodes[NewParent].Parent = OldParent;
+	Tree.Nodes[NewParent].Bounds = LeafBounds + Tree.Nodes[Sibling].Bounds;
+	Tree.Nodes[NewParent].Height = Tree.Nodes[Sibling].Height + 1;
+	Tree.Nodes[NewParent].Child1 = Sibling;
+	Tree.Nodes[NewParent].Child2 = Leaf;
+	Tree.Nodes[Sibling].Parent = NewParent;
+	Tree.Nodes[Leaf].Parent = NewParent;
+
+	if (OldParent != INDEX_NONE)
+	{
+		FTetherDynamicTreeNode& OldParentNode = Tree.Nodes[OldParent];
+		(OldParentNode.Child1 == Sibling ? OldParentNode.Child1 : OldParentNode.Child2) = NewParent;
+	}
+	else
+	{
+		Tree.Root = NewParent;
+	}
+
+	Refit(Tree, Tree.Nodes[Leaf].Parent);
+}
+
+void UTetherHashingDynamicTree::RemoveLeaf(FTetherDynamicTreeData& Tree, int32 Leaf)
+{
+	if (Leaf == Tree.Root)
+	{
+		Tree.Root = INDEX_NONE;
+		return;
+	}
+
+	const int32 Parent = Tree.Nodes[Leaf].Parent;
+	const int32 GrandParent = Tree.Nodes[Parent].Parent;
+	const int32 Sibling = Tree.Nodes[Parent].Child1 == Leaf ? Tree.Nodes[Parent].Child2 : Tree.Nodes[Parent].Child1;
+
+	// Replace the parent with the sibling
+	if (GrandParent != INDEX_NONE)
+	{
+		FTetherDynamicTreeNode& GrandParentNode = Tree.Nodes[GrandParent];
+		(GrandParentNode.Child1 == Parent ? GrandParentNode.Child1 : GrandParentNode.Child2) = Sibling;
+		Tree.Nodes[Sibling].Parent = GrandParent;
+		FreeNode(Tree, Parent);
+		Refit(Tree, GrandParent);
+	}
+	else
+	{
+		Tree.Root = Sibling;
+		Tree.Nodes[Sibling].Parent = INDEX_NONE;
+		FreeNode(Tree, Parent);
+	}
+
+	Tree.Nodes[Leaf].Parent = INDEX_NONE;
+}
+
+void UTetherHashingDynamicTree::Refit(FTetherDynamicTreeData& Tree, int32 NodeIndex)
+{
+	while (NodeIndex != INDEX_NONE)
+	{
+		NodeIndex = Balance(Tree, NodeIndex);
+
+		FTetherDynamicTreeNode& Node = Tree.Nodes[NodeIndex];
+		const FTetherDynamicTreeNode& Child1 = Tree.Nodes[Node.Child1];
+		const FTetherDynamicTreeNode& Child2 = Tree.Nodes[Node.Child2];
+		Node.Height = 1 + FMath::Max(Child1.Height, Child2.Height);
+		Node.Bounds = Child1.Bounds + Child2.Bounds;
+
+		NodeIndex = Node.Parent;
+	}
+}
+
+int32 UTetherHashingDynamicTree::Balance(FTetherDynamicTreeData& Tree, int32 NodeIndex)
+{
+	FTetherDynamicTreeNode& A = Tree.Nodes[NodeIndex];
+	if (A.IsLeaf() || A.Height < 2)
+	{
+		return NodeIndex;
+	}
+
+	const int32 IndexB = A.Child1;
+	const int32 IndexC = A.Child2;
+	FTetherDynamicTreeNode& B = Tree.Nodes[IndexB];
+	FTetherDynamicTreeNode& C = Tree.Nodes[IndexC];
+
+	const int32 Imbalance = C.Height - B.Height;
+
+	// Swaps the node in the parent's child slot, or the root
+	auto ReplaceInParent = [&Tree, NodeIndex](int32 Parent, int32 NewChild)
+	{
+		if (Parent != INDEX_NONE)
+		{
+			FTetherDynamicTreeNode& ParentNode = Tree.Nodes[Parent];
+			(ParentNode.Child1 == NodeIndex ? ParentNode.Child1 : ParentNode.Child2) = NewChild;
+		}
+		else
+		{
+			Tree.Root = NewChild;
+		}
+	};
+
+	// Rotate C up
+	if (Imbalance > 1)
+	{
+		const int32 IndexF = C.Child1;
+		const int32 IndexG = C.Child2;
+		FTetherDynamicTreeNode& F = Tree.Nodes[IndexF];
+		FTetherDynamicTreeNode& G = Tree.Nodes[IndexG];
+
+		C.Child1 = NodeIndex;
+		C.Parent = A.Parent;
+		A.Parent = IndexC;
+		ReplaceInParent(C.Parent, IndexC);
+
+		if (F.Height > G.Height)
+		{
+			C.Child2 = IndexF;
+			A.Child2 = IndexG;
+			G.Parent = NodeIndex;
+			A.Bounds = B.Bounds + G.Bounds;
+			C.Bounds = A.Bounds + F.Bounds;
+			A.Height = 1 + FMath::Max(B.Height, G.Height);
+			C.Height = 1 + FMath::Max(A.Height, F.Height);
+		}
+		else
+		{
+			C.Child2 = IndexG;
+			A.Child2 = IndexF;
+			F.Parent = NodeIndex;
+			A.Bounds = B.Bounds + F.Bounds;
+			C.Bounds = A.Bounds + G.Bounds;
+			A.Height = 1 + FMath::Max(B.Height, F.Height);
+			C.Height = 1 + FMath::Max(A.Height, G.Height);
+		}
+		return IndexC;
+	}
+
+	// Rotate B up
+	if (Imbalance < -1)
+	{
+		const int32 IndexD = B.Child1;
+		const int32 IndexE = B.Child2;
+		FTetherDynamicTreeNode& D = Tree.Nodes[IndexD];
+		FTetherDynamicTreeNode& E = Tree.Nodes[IndexE];
+
+		B.Child1 = NodeIndex;
+		B.Parent = A.Parent;
+		A.Parent = IndexB;
+		ReplaceInParent(B.Parent, IndexB);
+
+		if (D.Height > E.Height)
+		{
+			B.Child2 = IndexD;
+			A.Child1 = IndexE;
+			E.Parent = NodeIndex;
+			A.Bounds = C.Bounds + E.Bounds;
+			B.Bounds = A.Bounds + D.Bounds;
+			A.Height = 1 + FMath::Max(C.Height, E.Height);
+			B.Height = 1 + FMath::Max(A.Height, D.Height);
+		}
+		else
+		{
+			B.Child2 = IndexE;
+			A.Child1 = IndexD;
+			D.Parent = NodeIndex;
+			A.Bounds = C.Bounds + D.Bounds;
+			B.Bounds = A.Bounds + E.Bounds;
+			A.Height = 1 + FMath::Max(C.Height, D.Height);
+			B.Height = 1 + FMath::Max(A.Height, E.Height);
+		}
+		return IndexB;
+	}
+
+	return NodeIndex;
+}
+
+void UTetherHashingDynamicTree::DrawDebug(const TArray<FTetherShape*>* Shapes, const FSpatialHashingInput* Input,
+	const FSpatialHashingOutput* Output, const FTransform& Origin, TArray<FTetherDebugText>* PendingDebugText,
+	float LifeTime, FAnimInstanceProxy* Proxy, const UWorld* World, bool bDrawAll, const FColor& Color,
+	bool bPersistentLines, float Thickness) const
+{
+#if ENABLE_DRAW_DEBUG
+	if (!Proxy && !World)
+	{
+		return;
+	}
+
+	if (!FTether::CVarTetherDrawDynamicTree.GetValueOnAnyThread())
+	{
+		return;
+	}
+
+	const FTetherDynamicTreeData& Tree = Output->DynamicTree;
+	for (const FTetherDynamicTreeNode& Node : Tree.Nodes)
+	{
+		// Skip free nodes
+		if (Node.Height < 0)
+		{
+			continue;
+		}
+
+		// Leaves are drawn in the given color, internal nodes only when drawing everything
+		if (Node.IsLeaf())
+		{
+			UTetherDrawing::DrawBox(World, Proxy, Node.Bounds.GetCenter(), Node.Bounds.GetExtent(), FQuat::Identity,
+				Color, bPersistentLines, LifeTime, Thickness);
+		}
+		else if (bDrawAll)
+		{
+			UTetherDrawing::DrawBox(World, Proxy, Node.Bounds.GetCenter(), Node.Bounds.GetExtent(), FQuat::Identity,
+				FColor::Orange, bPersistentLines, LifeTime, Thickness);
+		}
+	}
+#endif
+}
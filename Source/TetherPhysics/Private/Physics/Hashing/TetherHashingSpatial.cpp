@@ -5,7 +5,6 @@
 
 #include "TetherStatics.h"
 #include "Animation/AnimInstanceProxy.h"
-#include "Shapes/TetherShape_AxisAlignedBoundingBox.h"
 #include "System/TetherDrawing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherHashingSpatial)
@@ -27,7 +26,8 @@ void UTetherHashingSpatial::Solve(const TArray<FTetherShape*>* InShapes, const F
 	
 	// Clear previous pairs and hash map
 	Output->ShapePairs.Reset();
-	Output->SpatialHashMap.Reset();
+	Output->SpatialHashCells.Reset();
+	Output->ShapePairKeys.Reset();
 
 	// Initialize the resulting bucket size. The condition isn't needed but may aid debugging
 	Output->BucketSize = Input->BucketSizeMode != ETetherBucketSizingStrategy::Automatic ? Input->BucketSize : FVector::ZeroVector;
@@ -39,16 +39,20 @@ void UTetherHashingSpatial::Solve(const TArray<FTetherShape*>* InShapes, const F
 	FVector MaxBucketSize { GlobalMinBucketSize };  // Start with a global minimum
 
 	// Loop through all shapes to find the maximum required bucket size
-	const TArray<FTetherShape*> Shapes = *InShapes;
+	const TArray<FTetherShape*>& Shapes = *InShapes;
+	TArray<FBox, TInlineAllocator<64>> ShapeBounds;
+	ShapeBounds.Reserve(Shapes.Num());
 	for (int32 i = 0; i < Shapes.Num(); i++)
 	{
-		// Get the bounding box for the current shape in world space
-		FTetherShape_AxisAlignedBoundingBox AABB = Shapes[i]->GetTetherShapeObject()->GetBoundingBox(*Shapes[i]);
+		// Get the cached bounds for the current shape in world space
+		ensure(Shapes[i]->IsWorldSpace());
+		const FTetherShapeBounds& Bounds = Shapes[i]->GetBounds();
 
-		ensure(AABB.IsWorldSpace());
+		// Cache the bounds, we need them again when inserting into the grid
+		ShapeBounds.Emplace(Bounds.Min, Bounds.Max);
 
 		// Calculate the AABB size in world space
-		FVector AABBSize = AABB.Max - AABB.Min;
+		FVector AABBSize = Bounds.Max - Bounds.Min;
 
 		// Compare with the current max bucket size and adjust accordingly
 		MaxBucketSize.X = FMath::Max(MaxBucketSize.X, AABBSize.X);
@@ -65,87 +69,107 @@ void UTetherHashingSpatial::Solve(const TArray<FTetherShape*>* InShapes, const F
 			Output->BucketSize.X, Output->BucketSize.Y, Output->BucketSize.Z);
 	}
 
-	// Now add all shapes to the spatial hash map using the fixed bucket size
+	// The grid is laid out relative to the origin, with the OriginOffset applied (matches DrawDebug)
+	FTransform GridTransform = Origin;
+	GridTransform.SetLocation(Origin.TransformPosition(Input->OriginOffset));
+
+	// Now add all shapes to the spatial hash cell table using the fixed bucket size
+	const bool bLog = FTether::CVarTetherLogSpatialHashing.GetValueOnAnyThread();
+	FString DebugString;
 	for (int32 i = 0; i < Shapes.Num(); i++)
 	{
-		// Init debug info string
-		FString DebugString = FString::Printf(TEXT("{ %s }"), *Shapes[i]->GetName());
+		// Init debug info string, only when logging to avoid needless allocations
+		if (bLog)
+		{
+			DebugString = FString::Printf(TEXT("{ %s }"), *Shapes[i]->GetName());
+		}
 
-		// Add shape to spatial hash
-		AddShapeToSpatialHash(Input, Output, i, Shapes[i], DebugString);
+		// Add shape to every bucket it overlaps
+		AddShapeToSpatialHash(Output, GridTransform, i, ShapeBounds[i], bLog ? &DebugString : nullptr);
 
 		// Output debug info
-		if (FTether::CVarTetherLogSpatialHashing.GetValueOnAnyThread())
+		if (bLog)
 		{
 			UE_LOG(LogTether, Log, TEXT("%s"), *DebugString);
 		}
 	}
+
+	// Sort the entries into contiguous cells
+	FTetherSpatialHashCellTable& Cells = Output->SpatialHashCells;
+	Cells.Build();
 	
-	// Generate pairs based on spatial proximity and efficiency rating
-	for (const auto& HashEntry : Output->SpatialHashMap)
+	// Generate pairs from every bucket. Shapes that straddle a bucket boundary are present in each bucket they
+	// overlap, so any two overlapping shapes always share at least one bucket and no neighbor search is required
+	for (int32 Slot = 0; Slot < Cells.NumSlots(); Slot++)
 	{
-		const TArray<int32>& Indices = HashEntry.Value;
+		const int32 Start = Cells.SlotStarts[Slot];
+		const int32 End = Cells.SlotStarts[Slot + 1];
 
-		for (int32 i = 0; i < Indices.Num(); i++)
+		for (int32 i = Start; i < End; i++)
 		{
-			for (int32 j = i + 1; j < Indices.Num(); j++)
+			for (int32 j = i + 1; j < End; j++)
 			{
-				int32 IndexA = Indices[i];
-				int32 IndexB = Indices[j];
+				// Different cells can share a hash slot
+				if (Cells.CellKeys[i] != Cells.CellKeys[j])
+				{
+					continue;
+				}
+
+				const int32 IndexA = Cells.ShapeIndices[i];
+				const int32 IndexB = Cells.ShapeIndices[j];
 
-				FTetherShape* ShapeA = Shapes[IndexA];
-				FTetherShape* ShapeB = Shapes[IndexB];
+				// Filter before deduplicating, it is cheaper than the set lookup
+				if (!ShouldPair(Input->IgnoreMatrix, Shapes[IndexA], Shapes[IndexB]))
+				{
+					continue;
+				}
 
-				// Check if shapes are in the same or adjacent buckets
-				if (IsInSameOrAdjacentBucket(ShapeA, ShapeB))
+				// The same pair may share several buckets, only emit it once
+				bool bAlreadyPaired = false;
+				Output->ShapePairKeys.Add(ComputeShapePairKey(IndexA, IndexB), &bAlreadyPaired);
+				if (!bAlreadyPaired)
 				{
-					// Determine which shape should perform the evaluation based on EfficiencyRating
-					Output->ShapePairs.Add(FTetherShapePair(ShapeA, ShapeB));
+					Output->ShapePairs.Add(FTetherShapePair(Shapes[IndexA], Shapes[IndexB]));
 				}
 			}
 		}
 	}
 }
 
-void UTetherHashingSpatial::AddShapeToSpatialHash(const FSpatialHashingInput* Input, FSpatialHashingOutput* Output,
-	int32 ShapeIndex, const FTetherShape* Shape, FString& DebugString)
+void UTetherHashingSpatial::AddShapeToSpatialHash(FSpatialHashingOutput* Output, const FTransform& GridTransform,
+	int32 ShapeIndex, const FBox& Bounds, FString* DebugString)
 {
-	FIntVector HashKey = ComputeSpatialHashKey(Input, Output, Shape, DebugString);
-	DebugString += FString::Printf(TEXT(" HashKey: %s"), *HashKey.ToString());
-	TArray<int32>& HashValue = Output->SpatialHashMap.FindOrAdd(HashKey);
-	HashValue.Add(ShapeIndex);
+	// Bring the bounds into grid space and find the range of buckets they cover
+	const FBox GridBounds = Bounds.InverseTransformBy(GridTransform);
+	const FIntVector MinKey = ComputeSpatialHashKey(GridBounds.Min, Output->BucketSize);
+	const FIntVector MaxKey = ComputeSpatialHashKey(GridBounds.Max, Output->BucketSize);
+	if (DebugString)
+	{
+		*DebugString += FString::Printf(TEXT(" HashKey: %s -> %s"), *MinKey.ToString(), *MaxKey.ToString());
+	}
+
+	for (int32 X = MinKey.X; X <= MaxKey.X; X++)
+	{
+		for (int32 Y = MinKey.Y; Y <= MaxKey.Y; Y++)
+		{
+			for (int32 Z = MinKey.Z; Z <= MaxKey.Z; Z++)
+			{
+				Output->SpatialHashCells.Add(FIntVector(X, Y, Z), ShapeIndex);
+			}
+		}
+	}
 }
 
-FIntVector UTetherHashingSpatial::ComputeSpatialHashKey(const FSpatialHashingInput* Input, const FSpatialHashingOutput* Output,
-	const FTetherShape* Shape, FString& DebugString)
+FIntVector UTetherHashingSpatial::ComputeSpatialHashKey(const FVector& GridPosition, const FVector& BucketSize)
 {
-	// Get the position of the shape's center
-	FVector Position = Shape->LocalSpaceData->GetLocalSpaceCenter();
-
-	// Calculate the hash key based on the bucket size and position relative to the new origin
+	// Calculate the hash key based on the bucket size and position relative to the grid origin
 	return FIntVector(
-		FMath::FloorToInt((Position.X) / Output->BucketSize.X),
-		FMath::FloorToInt((Position.Y) / Output->BucketSize.Y),
-		FMath::FloorToInt((Position.Z) / Output->BucketSize.Z)
+		FMath::FloorToInt(GridPosition.X / BucketSize.X),
+		FMath::FloorToInt(GridPosition.Y / BucketSize.Y),
+		FMath::FloorToInt(GridPosition.Z / BucketSize.Z)
 	);
 }
 
-bool UTetherHashingSpatial::AreBucketsAdjacent(int32 BucketA, int32 BucketB)
-{
-	// Implement logic to determine if two buckets are adjacent
-	// This could involve a simple comparison of bucket indices or more complex adjacency logic
-
-	// DEVNOTE: This is Simple 1D Adjacency, but I'm not convinced 3D would actually perform better
-	return FMath::Abs(BucketA - BucketB) <= 1;
-}
-
-bool UTetherHashingSpatial::IsInSameOrAdjacentBucket(const FTetherShape* ShapeA, const FTetherShape* ShapeB)
-{
-	// Implement logic to determine if two shapes are in the same or adjacent buckets
-	// This could involve checking spatial hash values or bucket coordinates
-	return ShapeA->HashIndex == ShapeB->HashIndex || AreBucketsAdjacent(ShapeA->HashIndex, ShapeB->HashIndex);
-}
-
 void UTetherHashingSpatial::DrawDebugBucket(FAnimInstanceProxy* Proxy, const UWorld* World,
 	const FTransform& Transform, const FIntVector& BucketIndex, const FVector& BucketSize, const FColor& Color,
 	bool bPersistentLines, float LifeTime, float Thickness)
@@ -206,7 +230,7 @@ void UTetherHashingSpatial::DrawDebug(const TArray<FTetherShape*>* Shapes, const
 		LifeTime, OriginThickness);
 
 	// Abort if we hashed nothing
-	if (Output->SpatialHashMap.Num() == 0)
+	if (Output->SpatialHashCells.Num() == 0)
 	{
 		return;
 	}
@@ -217,15 +241,15 @@ void UTetherHashingSpatial::DrawDebug(const TArray<FTetherShape*>* Shapes, const
 	// If we want to draw all buckets, first calculate the bounds
 	if (bDrawAll)
 	{
-		for (const auto& HashEntry : Output->SpatialHashMap)
+		for (const FIntVector& CellKey : Output->SpatialHashCells.CellKeys)
 		{
-			MinBucketIndex.X = FMath::Min(MinBucketIndex.X, HashEntry.Key.X);
-			MinBucketIndex.Y = FMath::Min(MinBucketIndex.Y, HashEntry.Key.Y);
-			MinBucketIndex.Z = FMath::Min(MinBucketIndex.Z, HashEntry.Key.Z);
+			MinBucketIndex.X = FMath::Min(MinBucketIndex.X, CellKey.X);
+			MinBucketIndex.Y = FMath::Min(MinBucketIndex.Y, CellKey.Y);
+			MinBucketIndex.Z = FMath::Min(MinBucketIndex.Z, CellKey.Z);
 
-			MaxBucketIndex.X = FMath::Max(MaxBucketIndex.X, HashEntry.Key.X);
-			MaxBucketIndex.Y = FMath::Max(MaxBucketIndex.Y, HashEntry.Key.Y);
-			MaxBucketIndex.Z = FMath::Max(MaxBucketIndex.Z, HashEntry.Key.Z);
+			MaxBucketIndex.X = FMath::Max(MaxBucketIndex.X, CellKey.X);
+			MaxBucketIndex.Y = FMath::Max(MaxBucketIndex.Y, CellKey.Y);
+			MaxBucketIndex.Z = FMath::Max(MaxBucketIndex.Z, CellKey.Z);
 		}
 
 		// Iterate over all possible bucket indices in the range from MinBucketIndex to MaxBucketIndex
@@ -245,11 +269,11 @@ void UTetherHashingSpatial::DrawDebug(const TArray<FTetherShape*>* Shapes, const
 	else
 	{
 		// Draw only the buckets that contain shapes
-		for (const auto& HashEntry : Output->SpatialHashMap)
+		Output->SpatialHashCells.ForEachOccupiedCell([&](const FIntVector& CellKey)
 		{
-			DrawDebugBucket(Proxy, World, Origin, HashEntry.Key, Output->BucketSize, Color, bPersistentLines, 
+			DrawDebugBucket(Proxy, World, Origin, CellKey, Output->BucketSize, Color, bPersistentLines, 
 			LifeTime, Thickness);
-		}
+		});
 	}
 #endif
 }
@@ -0,0 +1,229 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Hashing/TetherHashingSweepAndPrune.h"
+
+#include "TetherStatics.h"
+#include "System/TetherDrawing.h"
+#include "System/TetherVersioning.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherHashingSweepAndPrune)
+
+namespace FTether
+{
+	TAutoConsoleVariable<bool> CVarTetherLogSweepAndPrune(TEXT("p.Tether.SweepAndPrune.Log"), false, TEXT("Log Tether Sweep and Prune"));
+	TAutoConsoleVariable<bool> CVarTetherDrawSweepAndPrune(TEXT("p.Tether.SweepAndPrune.Draw"), false, TEXT("Draw Tether Sweep and Prune bounds to world"));
+	TAutoConsoleVariable<float> CVarTetherSweepAndPruneAxisHysteresis(TEXT("p.Tether.SweepAndPrune.AxisHysteresis"), 1.25f, TEXT("Another axis must have this many times the spread of the current sweep axis before the sweep axis changes, which would rebuild the endpoints"));
+}
+
+void UTetherHashingSweepAndPrune::Solve(const TArray<FTetherShape*>* InShapes, const FTetherIO* InputData,
+	FTetherIO* OutputData, const FTransform& Origin, float DeltaTime, double WorldTime) const
+{
+	const auto* Input = InputData->GetDataIO<FSpatialHashingInput>();
+	auto* Output = OutputData->GetDataIO<FSpatialHashingOutput>();
+	FTetherSweepAndPruneData& Data = Output->SweepAndPrune;
+
+	// Clear previous pairs, the endpoints persist
+	Output->ShapePairs.Reset();
+	Output->SpatialHashCells.Reset();
+	Output->BucketSize = FVector::ZeroVector;
+
+	const TArray<FTetherShape*>& Shapes = *InShapes;
+
+	// Detect changes to the shapes being hashed
+	bool bShapesChanged = Data.Shapes.Num() != Shapes.Num();
+	for (int32 i = 0; i < Shapes.Num() && !bShapesChanged; i++)
+	{
+		bShapesChanged = Data.Shapes[i] != Shapes[i];
+	}
+
+	// Gather the current bounds
+	Data.ShapeBounds.Reset();
+	for (const FTetherShape* Shape : Shapes)
+	{
+		ensure(Shape->IsWorldSpace());
+		Data.ShapeBounds.Add(Shape->GetBounds().GetBox());
+	}
+
+	// Sweep along the axis with the greatest spread, testing the other two axes for each open interval
+	const int32 SweepAxis = ComputeSweepAxis(Data);
+	const bool bAxisChanged = SweepAxis != Data.SweepAxis;
+	Data.SweepAxis = SweepAxis;
+
+	if (bShapesChanged || bAxisChanged)
+	{
+		Data.Shapes.Reset();
+		Data.Shapes.Append(Shapes);
+		RebuildEndpoints(Data);
+	}
+	else
+	{
+		// Shapes move coherently between ticks, so the swept axis is nearly sorted already
+		UpdateEndpoints(Data);
+	}
+
+	const int32 AxisB = (Data.SweepAxis + 1) % 3;
+	const int32 AxisC = (Data.SweepAxis + 2) % 3;
+
+	Data.ActiveShapes.Reset();
+	for (const FTetherSweepAndPruneEndpoint& Endpoint : Data.Endpoints)
+	{
+		if (Endpoint.bMax)
+		{
+#if UE_5_04_OR_LATER
+			Data.ActiveShapes.RemoveSingleSwap(Endpoint.ShapeIndex, EAllowShrinking::No);
+#else
+			Data.ActiveShapes.RemoveSingleSwap(Endpoint.ShapeIndex, false);
+#endif
+			continue;
+		}
+
+		const FBox& Bounds = Data.ShapeBounds[Endpoint.ShapeIndex];
+		for (const int32 ActiveIndex : Data.ActiveShapes)
+		{
+			const FBox& ActiveBounds = Data.ShapeBounds[ActiveIndex];
+			if (Bounds.Min[AxisB] <= ActiveBounds.Max[AxisB] && Bounds.Max[AxisB] >= ActiveBounds.Min[AxisB] &&
+				Bounds.Min[AxisC] <= ActiveBounds.Max[AxisC] && Bounds.Max[AxisC] >= ActiveBounds.Min[AxisC] &&
+				ShouldPair(Input->IgnoreMatrix, Shapes[ActiveIndex], Shapes[Endpoint.ShapeIndex]))
+			{
+				Output->ShapePairs.Add(FTetherShapePair(Shapes[ActiveIndex], Shapes[Endpoint.ShapeIndex]));
+			}
+		}
+		Data.ActiveShapes.Add(Endpoint.ShapeIndex);
+	}
+
+	if (FTether::CVarTetherLogSweepAndPrune.GetValueOnAnyThread())
+	{
+		UE_LOG(LogTether, Log, TEXT("Sweep and Prune: %d shapes, %d pairs, axis %d%s"), Shapes.Num(),
+			Output->ShapePairs.Num(), Data.SweepAxis, bShapesChanged || bAxisChanged ? TEXT(" (rebuilt)") : TEXT(""));
+	}
+}
+
+void UTetherHashingSweepAndPrune::RebuildEndpoints(FTetherSweepAndPruneData& Data)
+{
+	const int32 Axis = Data.SweepAxis;
+	TArray<FTetherSweepAndPruneEndpoint>& Endpoints = Data.Endpoints;
+	Endpoints.Reset();
+	for (int32 i = 0; i < Data.ShapeBounds.Num(); i++)
+	{
+		Endpoints.Emplace(Data.ShapeBounds[i].Min[Axis], i, false);
+		Endpoints.Emplace(Data.ShapeBounds[i].Max[Axis], i, true);
+	}
+	Endpoints.Sort();
+}
+
+void UTetherHashingSweepAndPrune::UpdateEndpoints(FTetherSweepAndPruneData& Data)
+{
+	const int32 Axis = Data.SweepAxis;
+	TArray<FTetherSweepAndPruneEndpoint>& Endpoints = Data.Endpoints;
+
+	// Refresh the values in place
+	for (FTetherSweepAndPruneEndpoint& Endpoint : Endpoints)
+	{
+		const FBox& Bounds = Data.ShapeBounds[Endpoint.ShapeIndex];
+		Endpoint.Value = Endpoint.bMax ? Bounds.Max[Axis] : Bounds.Min[Axis];
+	}
+
+	// Insertion sort, close to linear when the order barely changed since the last tick
+	for (int32 i = 1; i < Endpoints.Num(); i++)
+	{
+		const FTetherSweepAndPruneEndpoint Endpoint = Endpoints[i];
+		int32 j = i - 1;
+		while (j >= 0 && Endpoint < Endpoints[j])
+		{
+			Endpoints[j + 1] = Endpoints[j];
+			j--;
+		}
+		Endpoints[j + 1] = Endpoint;
+	}
+}
+
+int32 UTetherHashingSweepAndPrune::ComputeSweepAxis(const FTetherSweepAndPruneData& Data)
+{
+	const int32 CurrentAxis = FMath::Clamp(Data.SweepAxis, 0, 2);
+	if (Data.ShapeBounds.Num() < 2)
+	{
+		return CurrentAxis;
+	}
+
+	// Spread of the shape centers along each axis, accumulated with Welford's method in double precision so that
+	// shapes far from the world origin don't lose the variance to cancellation
+	double Mean[3] = { 0.0, 0.0, 0.0 };
+	double M2[3] = { 0.0, 0.0, 0.0 };
+	int32 Count = 0;
+	for (const FBox& Bounds : Data.ShapeBounds)
+	{
+		const FVector Center = Bounds.GetCenter();
+		Count++;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const double Value = Center[Axis];
+			const double Delta = Value - Mean[Axis];
+			Mean[Axis] += Delta / Count;
+			M2[Axis] += Delta * (Value - Mean[Axis]);
+		}
+	}
+
+	// The sample count is shared by every axis, so M2 can be compared directly without dividing
+	int32 BestAxis = CurrentAxis;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (M2[Axis] > M2[BestAxis])
+		{
+			BestAxis = Axis;
+		}
+	}
+
+	// Only change axis when the new one wins by a margin, otherwise shapes with a similar spread on two axes would
+	// flip the axis every tick and rebuild the endpoints each time, losing the benefit of the incremental sort
+	const double Hysteresis = FMath::Max(1.0, (double)FTether::CVarTetherSweepAndPruneAxisHysteresis.GetValueOnAnyThread());
+	if (BestAxis != CurrentAxis && M2[BestAxis] > M2[CurrentAxis] * Hysteresis)
+	{
+		return BestAxis;
+	}
+	return CurrentAxis;
+}
+
+void UTetherHashingSweepAndPrune::DrawDebug(const TArray<FTetherShape*>* Shapes, const FSpatialHashingInput* Input,
+	const FSpatialHashingOutput* Output, const FTransform& Origin, TArray<FTetherDebugText>* PendingDebugText,
+	float LifeTime, FAnimInstanceProxy* Proxy, const UWorld* World, bool bDrawAll, const FColor& Color,
+	bool bPersistentLines, float Thickness) const
+{
+#if ENABLE_DRAW_DEBUG
+	if (!Proxy && !World)
+	{
+		return;
+	}
+
+	if (!FTether::CVarTetherDrawSweepAndPrune.GetValueOnAnyThread())
+	{
+		return;
+	}
+
+	const FTetherSweepAndPruneData& Data = Output->SweepAndPrune;
+
+	// Draw the bounds that were swept, paired shapes are drawn in the given color
+	for (int32 i = 0; i < Data.ShapeBounds.Num() && i < Data.Shapes.Num(); i++)
+	{
+		const FTetherShape* Shape = Data.Shapes[i];
+		const bool bPaired = Output->ShapePairs.ContainsByPredicate([Shape](const FTetherShapePair& Pair)
+		{
+			return Pair.ContainsShape(Shape);
+		});
+
+		if (bPaired || bDrawAll)
+		{
+			const FBox& Bounds = Data.ShapeBounds[i];
+			UTetherDrawing::DrawBox(World, Proxy, Bounds.GetCenter(), Bounds.GetExtent(), FQuat::Identity,
+				bPaired ? Color : FColor::Silver, bPersistentLines, LifeTime, Thickness);
+		}
+	}
+
+	// Draw a line between each pair
+	for (const FTetherShapePair& Pair : Output->ShapePairs)
+	{
+		UTetherDrawing::DrawLine(World, Proxy, Pair.ShapeA->GetAppliedWorldTransform().GetLocation(),
+			Pair.ShapeB->GetAppliedWorldTransform().GetLocation(), Color, bPersistentLines, LifeTime, Thickness);
+	}
+#endif
+}
@@ -0,0 +1,21 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Solvers/Integration/TetherIntegrationSolver.h"
+
+#include "TetherPhysicsTypes.h"
+#include "Physics/Solvers/TetherBodyStore.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherIntegrationSolver)
+
+void UTetherIntegrationSolver::SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	for (int32 i = Range.Begin; i < Range.GetEnd(Bodies.Num()); i++)
+	{
+		if (Bodies.IntegrationSolvers[i] == this)
+		{
+			FTetherCommonShapeData* Data = Bodies.ShapeData[i];
+			Solve(Bodies.Shapes[i], &Data->IntegrationInput, &Data->IntegrationOutput, DeltaTime, WorldTime);
+		}
+	}
+}
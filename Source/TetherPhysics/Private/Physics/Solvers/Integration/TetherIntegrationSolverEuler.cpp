@@ -3,6 +3,8 @@
 
 #include "Physics/Solvers/Integration/TetherIntegrationSolverEuler.h"
 
+#include "Physics/Solvers/TetherBodyStore.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherIntegrationSolverEuler)
 
 void UTetherIntegrationSolverEuler::Solve(const FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData, float DeltaTime, double WorldTime) const
@@ -51,4 +53,32 @@ void UTetherIntegrationSolverEuler::Solve(const FTetherShape* Shape, const FTeth
 
 	// Update Transform
 	Output->Transform = Transform;
-}
\ No newline at end of file
+}
+
+void UTetherIntegrationSolverEuler::SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	// The batched math below is this class's Solve(), a subclass may have overridden it
+	if (GetClass() != StaticClass())
+	{
+		Super::SolveAll(Bodies, DeltaTime, WorldTime, Range);
+		return;
+	}
+
+	for (int32 i = Range.Begin; i < Range.GetEnd(Bodies.Num()); i++)
+	{
+		if (Bodies.IntegrationSolvers[i] != this)
+		{
+			continue;
+		}
+
+		// Update position using Euler integration
+		Bodies.Positions[i] += Bodies.LinearVelocities[i] * DeltaTime;
+
+		// Update rotation using Euler integration
+		const FVector& AngularVelocity = Bodies.AngularVelocities[i];
+		const FQuat AngularDelta { AngularVelocity, AngularVelocity.Size() * DeltaTime };
+		Bodies.Rotations[i] = (Bodies.Rotations[i] * AngularDelta).GetNormalized();
+
+		Bodies.ScatterTransform(i);
+	}
+}
@@ -3,8 +3,9 @@
 
 #include "Physics/Solvers/Physics/TetherPhysicsSolverAngular.h"
 
+#include "TetherPhysicsTypes.h"
 #include "TetherStatics.h"
-#include "Shapes/TetherShape_AxisAlignedBoundingBox.h"
+#include "Physics/Solvers/TetherBodyStore.h"
 #include "System/TetherDrawing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherPhysicsSolverAngular)
@@ -18,19 +19,83 @@ namespace FTether
 
 void UTetherPhysicsSolverAngular::ApplyAngularDamping(FVector& AngularVelocity, const FAngularInputSettings& Settings,
 	float DeltaTime)
+{
+	ApplyAngularDamping(AngularVelocity, Settings.AngularDamping, Settings.DampingModel, DeltaTime);
+}
+
+void UTetherPhysicsSolverAngular::ApplyAngularDamping(FVector& AngularVelocity, float AngularDamping,
+	ETetherDampingModel DampingModel, float DeltaTime)
 {
 	// Apply damping to slow down angular velocity
-	switch (Settings.DampingModel)
+	switch (DampingModel)
 	{
 	case ETetherDampingModel::SimpleLinear:
-		AngularVelocity *= (1.f - Settings.AngularDamping * DeltaTime);
+		AngularVelocity *= (1.f - AngularDamping * DeltaTime);
 		break;
 	case ETetherDampingModel::ExponentialDecay:
-		AngularVelocity *= FMath::Exp(-Settings.AngularDamping * DeltaTime);
+		AngularVelocity *= FMath::Exp(-AngularDamping * DeltaTime);
 		break;
 	}
 }
 
+void UTetherPhysicsSolverAngular::SolveEach(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	for (const int32 i : Bodies.GetActiveBodies(Range))
+	{
+		if (Bodies.AngularSolvers[i] == this)
+		{
+			FTetherCommonShapeData* Data = Bodies.ShapeData[i];
+			Solve(Bodies.Shapes[i], &Data->AngularInput, &Data->AngularOutput, DeltaTime, WorldTime);
+
+			// Keep the store in sync, it is scattered back to the output after solving
+			Bodies.AngularVelocities[i] = Data->AngularOutput.AngularVelocity;
+			Bodies.Inertias[i] = Data->AngularOutput.Inertia;
+		}
+	}
+}
+
+void UTetherPhysicsSolverAngular::SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	// The batched math below is this class's Solve(), a subclass may have overridden it
+	if (GetClass() != StaticClass())
+	{
+		SolveEach(Bodies, DeltaTime, WorldTime, Range);
+		return;
+	}
+
+	for (const int32 i : Bodies.GetActiveBodies(Range))
+	{
+		if (Bodies.AngularSolvers[i] != this)
+		{
+			continue;
+		}
+
+		FVector& AngularVelocity = Bodies.AngularVelocities[i];
+
+		// Inertial mode only applies damping
+		if (Bodies.SimulationModes[i] == ETetherSimulationMode::Inertial)
+		{
+			ApplyAngularDamping(AngularVelocity, Bodies.AngularDamping[i], Bodies.AngularDampingModels[i], DeltaTime);
+			continue;
+		}
+
+		// Simulated mode: Apply forces, acceleration, and damping
+		AngularVelocity += (Bodies.Torques[i] - Bodies.FrictionTorques[i]) * (FVector::OneVector / Bodies.Inertias[i]) * DeltaTime;
+		ApplyAngularDamping(AngularVelocity, Bodies.AngularDamping[i], Bodies.AngularDampingModels[i], DeltaTime);
+
+		// Apply angular drag due to air resistance
+		const float DragForce = Bodies.AngularDrag[i] * AngularVelocity.SizeSquared();
+		AngularVelocity -= AngularVelocity.GetSafeNormal() * DragForce * DeltaTime;
+
+		// Clamp the angular velocity to the maximum allowed value
+		const float AngularVelocityMagnitude = AngularVelocity.Size();
+		if (AngularVelocityMagnitude > Bodies.MaxAngularVelocities[i])
+		{
+			AngularVelocity *= Bodies.MaxAngularVelocities[i] / AngularVelocityMagnitude;
+		}
+	}
+}
+
 void UTetherPhysicsSolverAngular::Solve(const FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData,
 	float DeltaTime, double WorldTime) const
 {
@@ -53,8 +118,7 @@ void UTetherPhysicsSolverAngular::Solve(const FTetherShape* Shape, const FTether
 	FVector& AngularVelocity = Output->AngularVelocity;
 	FVector& Inertia = Output->Inertia;
 
-	const FTetherShape_AxisAlignedBoundingBox AABB = Shape->GetTetherShapeObject()->GetBoundingBox(*Shape);
-	const FVector BoxExtent = AABB.GetBoxExtents();
+	const FVector BoxExtent = Shape->GetBounds().GetExtents();
 
 	// Use dynamic inertia calculation based on BoxExtent if bUseDynamicInertia is true
 	if (Settings.bUseDynamicInertia)
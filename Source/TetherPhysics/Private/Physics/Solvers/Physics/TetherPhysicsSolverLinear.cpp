@@ -4,6 +4,8 @@
 #include "Physics/Solvers/Physics/TetherPhysicsSolverLinear.h"
 
 #include "Animation/AnimInstanceProxy.h"
+#include "TetherPhysicsTypes.h"
+#include "Physics/Solvers/TetherBodyStore.h"
 #include "System/TetherDrawing.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherPhysicsSolverLinear)
@@ -17,19 +19,84 @@ namespace FTether
 
 void UTetherPhysicsSolverLinear::ApplyLinearDamping(FVector& Velocity, const FLinearInputSettings& Settings,
 	float DeltaTime)
+{
+	ApplyLinearDamping(Velocity, Settings.LinearDamping, Settings.DampingModel, DeltaTime);
+}
+
+void UTetherPhysicsSolverLinear::ApplyLinearDamping(FVector& Velocity, float LinearDamping,
+	ETetherDampingModel DampingModel, float DeltaTime)
 {
 	// Apply damping to slow down linear velocity
-	switch (Settings.DampingModel)
+	switch (DampingModel)
 	{
 	case ETetherDampingModel::SimpleLinear:
-		Velocity *= (1.f - Settings.LinearDamping * DeltaTime);
+		Velocity *= (1.f - LinearDamping * DeltaTime);
 		break;
 	case ETetherDampingModel::ExponentialDecay:
-		Velocity *= FMath::Exp(-Settings.LinearDamping * DeltaTime);
+		Velocity *= FMath::Exp(-LinearDamping * DeltaTime);
 		break;
 	}
 }
 
+void UTetherPhysicsSolverLinear::SolveEach(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	for (const int32 i : Bodies.GetActiveBodies(Range))
+	{
+		if (Bodies.LinearSolvers[i] == this)
+		{
+			FTetherCommonShapeData* Data = Bodies.ShapeData[i];
+			Solve(Bodies.Shapes[i], &Data->LinearInput, &Data->LinearOutput, DeltaTime, WorldTime);
+
+			// Keep the store in sync, it is scattered back to the output after solving
+			Bodies.LinearVelocities[i] = Data->LinearOutput.LinearVelocity;
+		}
+	}
+}
+
+void UTetherPhysicsSolverLinear::SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	// The batched math below is this class's Solve(), a subclass may have overridden it
+	if (GetClass() != StaticClass())
+	{
+		SolveEach(Bodies, DeltaTime, WorldTime, Range);
+		return;
+	}
+
+	for (const int32 i : Bodies.GetActiveBodies(Range))
+	{
+		if (Bodies.LinearSolvers[i] != this)
+		{
+			continue;
+		}
+
+		FVector& LinearVelocity = Bodies.LinearVelocities[i];
+
+		// Inertial mode only applies damping, no external forces
+		if (Bodies.SimulationModes[i] == ETetherSimulationMode::Inertial)
+		{
+			ApplyLinearDamping(LinearVelocity, Bodies.LinearDamping[i], Bodies.LinearDampingModels[i], DeltaTime);
+			continue;
+		}
+
+		// Simulated mode: Apply forces, acceleration, and damping
+		const FVector Acceleration = Bodies.Forces[i] * Bodies.InverseMasses[i] + Bodies.Accelerations[i];
+		LinearVelocity += Acceleration * DeltaTime;
+
+		ApplyLinearDamping(LinearVelocity, Bodies.LinearDamping[i], Bodies.LinearDampingModels[i], DeltaTime);
+
+		// Apply linear drag due to air resistance
+		const float DragForce = Bodies.LinearDrag[i] * LinearVelocity.SizeSquared();
+		LinearVelocity -= LinearVelocity.GetSafeNormal() * DragForce * DeltaTime;
+
+		// Clamp the linear velocity to the maximum allowed value
+		const float LinearVelocityMagnitude = LinearVelocity.Size();
+		if (LinearVelocityMagnitude > Bodies.MaxLinearVelocities[i])
+		{
+			LinearVelocity *= Bodies.MaxLinearVelocities[i] / LinearVelocityMagnitude;
+		}
+	}
+}
+
 void UTetherPhysicsSolverLinear::Solve(FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData,
 	float DeltaTime, float WorldTime) const
 {
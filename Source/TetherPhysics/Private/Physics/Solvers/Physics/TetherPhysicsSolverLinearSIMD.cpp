@@ -0,0 +1,155 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Solvers/Physics/TetherPhysicsSolverLinearSIMD.h"
+
+#include "Physics/Solvers/TetherBodyStore.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherPhysicsSolverLinearSIMD)
+
+namespace FTetherLinearSIMDPrivate
+{
+	/** Lanes packed from the body store, one float per body */
+	enum ELane : uint8
+	{
+		VX, VY, VZ,			// Linear velocity
+		FX, FY, FZ,			// Net force
+		GX, GY, GZ,			// Acceleration, ignoring mass
+		InvMass,
+		Damping,
+		Drag,
+		MaxVelocity,
+		Simulated,			// 1 for awake simulated bodies, otherwise 0
+		Inertial,			// 1 for awake inertial bodies, otherwise 0
+		Exponential,		// 1 for the exponential decay damping model, otherwise 0
+		NumLanes
+	};
+}
+
+void UTetherPhysicsSolverLinearSIMD::SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const
+{
+	using namespace FTetherLinearSIMDPrivate;
+
+	// The lanes below are this class's Solve(), a subclass may have overridden it
+	if (GetClass() != StaticClass())
+	{
+		SolveEach(Bodies, DeltaTime, WorldTime, Range);
+		return;
+	}
+
+	FMemMark Mark(FMemStack::Get());
+
+	// Every active body that uses this solver, asleep and kinematic bodies were never gathered
+	TArray<int32, TMemStackAllocator<>> Indices;
+	for (const int32 i : Bodies.GetActiveBodies(Range))
+	{
+		if (Bodies.LinearSolvers[i] == this)
+		{
+			Indices.Add(i);
+		}
+	}
+
+	if (Indices.Num() == 0)
+	{
+		return;
+	}
+
+	// Transpose into float lanes, padded to a multiple of four with zeroed (masked out) lanes
+	const int32 Padded = Align(Indices.Num(), 4);
+	TArray<float, TMemStackAllocator<>> Lanes[NumLanes];
+	for (TArray<float, TMemStackAllocator<>>& Lane : Lanes)
+	{
+		Lane.SetNumZeroed(Padded);
+	}
+
+	for (int32 j = 0; j < Indices.Num(); j++)
+	{
+		const int32 i = Indices[j];
+		const FVector& Velocity = Bodies.LinearVelocities[i];
+		Lanes[VX][j] = Velocity.X;
+		Lanes[VY][j] = Velocity.Y;
+		Lanes[VZ][j] = Velocity.Z;
+
+		const ETetherSimulationMode Mode = Bodies.SimulationModes[i];
+		Lanes[FX][j] = Bodies.Forces[i].X;
+		Lanes[FY][j] = Bodies.Forces[i].Y;
+		Lanes[FZ][j] = Bodies.Forces[i].Z;
+		Lanes[GX][j] = Bodies.Accelerations[i].X;
+		Lanes[GY][j] = Bodies.Accelerations[i].Y;
+		Lanes[GZ][j] = Bodies.Accelerations[i].Z;
+		Lanes[InvMass][j] = Bodies.InverseMasses[i];
+		Lanes[Damping][j] = Bodies.LinearDamping[i];
+		Lanes[Drag][j] = Bodies.LinearDrag[i];
+		Lanes[MaxVelocity][j] = Bodies.MaxLinearVelocities[i];
+		Lanes[Simulated][j] = Mode == ETetherSimulationMode::Simulated ? 1.f : 0.f;
+		Lanes[Inertial][j] = Mode == ETetherSimulationMode::Inertial ? 1.f : 0.f;
+		Lanes[Exponential][j] = Bodies.LinearDampingModels[i] == ETetherDampingModel::ExponentialDecay ? 1.f : 0.f;
+	}
+
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+	const VectorRegister4Float SmallNumber = VectorSetFloat1(SMALL_NUMBER);
+
+	for (int32 j = 0; j < Padded; j += 4)
+	{
+		const VectorRegister4Float SimulatedMask = VectorCompareGT(VectorLoad(&Lanes[Simulated][j]), Half);
+		const VectorRegister4Float InertialMask = VectorCompareGT(VectorLoad(&Lanes[Inertial][j]), Half);
+		const VectorRegister4Float ExponentialMask = VectorCompareGT(VectorLoad(&Lanes[Exponential][j]), Half);
+
+		const VectorRegister4Float X = VectorLoad(&Lanes[VX][j]);
+		const VectorRegister4Float Y = VectorLoad(&Lanes[VY][j]);
+		const VectorRegister4Float Z = VectorLoad(&Lanes[VZ][j]);
+
+		// Acceleration = Force / Mass + Acceleration, only simulated bodies receive it
+		const VectorRegister4Float InverseMass = VectorLoad(&Lanes[InvMass][j]);
+		const VectorRegister4Float AX = VectorMultiplyAdd(VectorLoad(&Lanes[FX][j]), InverseMass, VectorLoad(&Lanes[GX][j]));
+		const VectorRegister4Float AY = VectorMultiplyAdd(VectorLoad(&Lanes[FY][j]), InverseMass, VectorLoad(&Lanes[GY][j]));
+		const VectorRegister4Float AZ = VectorMultiplyAdd(VectorLoad(&Lanes[FZ][j]), InverseMass, VectorLoad(&Lanes[GZ][j]));
+
+		VectorRegister4Float SX = VectorSelect(SimulatedMask, VectorMultiplyAdd(AX, Dt, X), X);
+		VectorRegister4Float SY = VectorSelect(SimulatedMask, VectorMultiplyAdd(AY, Dt, Y), Y);
+		VectorRegister4Float SZ = VectorSelect(SimulatedMask, VectorMultiplyAdd(AZ, Dt, Z), Z);
+
+		// Damping, both simulated and inertial bodies: SimpleLinear (1 - k * dt) or ExponentialDecay exp(-k * dt)
+		const VectorRegister4Float KDt = VectorMultiply(VectorLoad(&Lanes[Damping][j]), Dt);
+		const VectorRegister4Float DampingFactor = VectorSelect(ExponentialMask, VectorExp(VectorNegate(KDt)),
+			VectorSubtract(One, KDt));
+
+		SX = VectorMultiply(SX, DampingFactor);
+		SY = VectorMultiply(SY, DampingFactor);
+		SZ = VectorMultiply(SZ, DampingFactor);
+
+		// Quadratic drag opposing the direction of motion: V -= Normal(V) * k * |V|² * dt, i.e. V -= V * k * |V| * dt
+		const VectorRegister4Float SpeedSq = VectorMultiplyAdd(SZ, SZ, VectorMultiplyAdd(SY, SY, VectorMultiply(SX, SX)));
+		const VectorRegister4Float HasSpeed = VectorCompareGT(SpeedSq, SmallNumber);
+		const VectorRegister4Float Speed = VectorSqrt(SpeedSq);
+		const VectorRegister4Float DragScale = VectorSelect(HasSpeed,
+			VectorSubtract(One, VectorMultiply(VectorMultiply(VectorLoad(&Lanes[Drag][j]), Speed), Dt)), One);
+
+		VectorRegister4Float DX = VectorMultiply(SX, DragScale);
+		VectorRegister4Float DY = VectorMultiply(SY, DragScale);
+		VectorRegister4Float DZ = VectorMultiply(SZ, DragScale);
+
+		// Clamp to the maximum velocity
+		const VectorRegister4Float MaxSpeed = VectorLoad(&Lanes[MaxVelocity][j]);
+		const VectorRegister4Float DragSpeed = VectorSqrt(VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))));
+		const VectorRegister4Float ClampScale = VectorSelect(VectorCompareGT(DragSpeed, MaxSpeed),
+			VectorDivide(MaxSpeed, VectorMax(DragSpeed, SmallNumber)), One);
+
+		DX = VectorMultiply(DX, ClampScale);
+		DY = VectorMultiply(DY, ClampScale);
+		DZ = VectorMultiply(DZ, ClampScale);
+
+		// Blend: simulated takes the full result, inertial only the damping, everything else is unchanged
+		VectorStore(VectorSelect(SimulatedMask, DX, VectorSelect(InertialMask, SX, X)), &Lanes[VX][j]);
+		VectorStore(VectorSelect(SimulatedMask, DY, VectorSelect(InertialMask, SY, Y)), &Lanes[VY][j]);
+		VectorStore(VectorSelect(SimulatedMask, DZ, VectorSelect(InertialMask, SZ, Z)), &Lanes[VZ][j]);
+	}
+
+	// Write back to the store, masked out lanes were passed through unchanged
+	for (int32 j = 0; j < Indices.Num(); j++)
+	{
+		Bodies.LinearVelocities[Indices[j]] = FVector(Lanes[VX][j], Lanes[VY][j], Lanes[VZ][j]);
+	}
+}
@@ -0,0 +1,250 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Solvers/TetherBodyStore.h"
+
+#include "TetherPhysicsTypes.h"
+#include "TetherStatics.h"
+#include "Algo/BinarySearch.h"
+#include "System/TetherVersioning.h"
+
+void FTetherBodyStore::Reset()
+{
+	Shapes.Reset();
+	ShapeData.Reset();
+	LinearSolvers.Reset();
+	AngularSolvers.Reset();
+	IntegrationSolvers.Reset();
+	UniqueLinearSolvers.Reset();
+	UniqueAngularSolvers.Reset();
+	UniqueIntegrationSolvers.Reset();
+	ActiveBodies.Reset();
+	AwakeBodies.Reset();
+	AsleepBodies.Reset();
+	KinematicBodies.Reset();
+	Partitions.Reset();
+	PartitionSlots.Reset();
+}
+
+int32 FTetherBodyStore::Add(FTetherShape* Shape, FTetherCommonShapeData* Data)
+{
+	const int32 Index = Shapes.Add(Shape);
+	ensure(Shape->SimulationIndex == Index);
+	ShapeData.Add(Data);
+
+	LinearSolvers.Add(Data->Solvers.CurrentLinearSolver);
+	AngularSolvers.Add(Data->Solvers.CurrentAngularSolver);
+	IntegrationSolvers.Add(Data->Solvers.CurrentIntegrationSolver);
+
+	if (Data->Solvers.CurrentLinearSolver)
+	{
+		UniqueLinearSolvers.AddUnique(Data->Solvers.CurrentLinearSolver);
+	}
+	if (Data->Solvers.CurrentAngularSolver)
+	{
+		UniqueAngularSolvers.AddUnique(Data->Solvers.CurrentAngularSolver);
+	}
+	if (Data->Solvers.CurrentIntegrationSolver)
+	{
+		UniqueIntegrationSolvers.AddUnique(Data->Solvers.CurrentIntegrationSolver);
+	}
+
+	const ETetherBodyPartition Partition = GetPartitionFor(Shape);
+	Partitions.Add(Partition);
+	PartitionSlots.Add(GetPartition(Partition).Add(Index));
+	return Index;
+}
+
+ETetherBodyPartition FTetherBodyStore::GetPartitionFor(const FTetherShape* Shape)
+{
+	if (Shape->SimulationMode == ETetherSimulationMode::Kinematic)
+	{
+		return ETetherBodyPartition::Kinematic;
+	}
+	return Shape->IsAsleep() ? ETetherBodyPartition::Asleep : ETetherBodyPartition::Awake;
+}
+
+TArray<int32>& FTetherBodyStore::GetPartition(ETetherBodyPartition Partition)
+{
+	switch (Partition)
+	{
+	case ETetherBodyPartition::Asleep: return AsleepBodies;
+	case ETetherBodyPartition::Kinematic: return KinematicBodies;
+	default: return AwakeBodies;
+	}
+}
+
+const TArray<int32>& FTetherBodyStore::GetPartition(ETetherBodyPartition Partition) const
+{
+	return const_cast<FTetherBodyStore*>(this)->GetPartition(Partition);
+}
+
+bool FTetherBodyStore::UpdatePartition(int32 Index)
+{
+	const ETetherBodyPartition From = Partitions[Index];
+	const ETetherBodyPartition To = GetPartitionFor(Shapes[Index]);
+	if (From == To)
+	{
+		return false;
+	}
+
+	// Swap-remove from the old partition, the body that fills the gap takes over our slot
+	TArray<int32>& Source = GetPartition(From);
+	const int32 Slot = PartitionSlots[Index];
+#if UE_5_04_OR_LATER
+	Source.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+#else
+	Source.RemoveAtSwap(Slot, 1, false);
+#endif
+	if (Source.IsValidIndex(Slot))
+	{
+		PartitionSlots[Source[Slot]] = Slot;
+	}
+
+	Partitions[Index] = To;
+	PartitionSlots[Index] = GetPartition(To).Add(Index);
+	return true;
+}
+
+void FTetherBodyStore::RefreshPartition(ETetherBodyPartition Partition)
+{
+	// Walk backwards, a removal swaps in a body that has already been visited
+	const TArray<int32>& Bodies = GetPartition(Partition);
+	for (int32 Slot = Bodies.Num() - 1; Slot >= 0; Slot--)
+	{
+		UpdatePartition(Bodies[Slot]);
+	}
+}
+
+TConstArrayView<int32> FTetherBodyStore::GetActiveBodies(const FTetherBodyRange& Range) const
+{
+	if (Range.Begin == 0 && Range.End == INDEX_NONE)
+	{
+		return ActiveBodies;
+	}
+
+	const int32 First = Algo::LowerBound(ActiveBodies, Range.Begin);
+	const int32 Last = Algo::LowerBound(ActiveBodies, Range.GetEnd(Num()));
+	return TConstArrayView<int32>(ActiveBodies.GetData() + First, FMath::Max(0, Last - First));
+}
+
+void FTetherBodyStore::Gather()
+{
+	const int32 NumBodies = Num();
+
+	SimulationModes.SetNumUninitialized(NumBodies);
+	Positions.SetNumUninitialized(NumBodies);
+	Rotations.SetNumUninitialized(NumBodies);
+
+	LinearVelocities.SetNumUninitialized(NumBodies);
+	Forces.SetNumUninitialized(NumBodies);
+	Accelerations.SetNumUninitialized(NumBodies);
+	InverseMasses.SetNumUninitialized(NumBodies);
+	LinearDamping.SetNumUninitialized(NumBodies);
+	LinearDrag.SetNumUninitialized(NumBodies);
+	MaxLinearVelocities.SetNumUninitialized(NumBodies);
+	LinearDampingModels.SetNumUninitialized(NumBodies);
+
+	AngularVelocities.SetNumUninitialized(NumBodies);
+	Torques.SetNumUninitialized(NumBodies);
+	FrictionTorques.SetNumUninitialized(NumBodies);
+	Inertias.SetNumUninitialized(NumBodies);
+	AngularDamping.SetNumUninitialized(NumBodies);
+	AngularDrag.SetNumUninitialized(NumBodies);
+	MaxAngularVelocities.SetNumUninitialized(NumBodies);
+	AngularDampingModels.SetNumUninitialized(NumBodies);
+
+	// Only awake, non-kinematic bodies are solved, sorted so that ranges can find their bodies
+	ActiveBodies = AwakeBodies;
+	ActiveBodies.Sort();
+
+	for (const int32 i : ActiveBodies)
+	{
+		const FTetherShape* Shape = Shapes[i];
+		const FTetherCommonShapeData* Data = ShapeData[i];
+
+		SimulationModes[i] = Shape->SimulationMode;
+		Positions[i] = Shape->GetAppliedWorldTransform().GetLocation();
+		Rotations[i] = Shape->GetAppliedWorldTransform().GetRotation();
+		LinearVelocities[i] = Data->LinearOutput.LinearVelocity;
+		AngularVelocities[i] = Data->AngularOutput.AngularVelocity;
+
+		const FLinearInputSettings& Linear = Data->LinearInput.Settings;
+		Forces[i] = Linear.Force - Linear.FrictionForce;
+		Accelerations[i] = Linear.Acceleration;
+		InverseMasses[i] = 1.f / FMath::Max(KINDA_SMALL_NUMBER, Linear.Mass);
+		LinearDamping[i] = Linear.LinearDamping;
+		LinearDrag[i] = Linear.LinearDragCoefficient;
+		MaxLinearVelocities[i] = Linear.MaxLinearVelocity;
+		LinearDampingModels[i] = Linear.DampingModel;
+
+		const FAngularInputSettings& Angular = Data->AngularInput.Settings;
+		if (Angular.PointOfApplication.IsNearlyZero())
+		{
+			// Apply the torque directly if there's no lever arm
+			Torques[i] = Angular.Torque;
+		}
+		else
+		{
+			// Calculate the torque based on the lever arm (cross product)
+			Torques[i] = FVector::CrossProduct(Angular.PointOfApplication - Angular.CenterOfMass, Angular.Torque);
+		}
+		FrictionTorques[i] = Angular.FrictionTorque;
+		AngularDamping[i] = Angular.AngularDamping;
+		AngularDrag[i] = Angular.AngularDragCoefficient;
+		MaxAngularVelocities[i] = Angular.MaxAngularVelocity;
+		AngularDampingModels[i] = Angular.DampingModel;
+
+		// Use dynamic inertia calculation based on BoxExtent if bUseDynamicInertia is true
+		if (Angular.bUseDynamicInertia)
+		{
+			const FVector BoxExtent = Shape->GetBounds().GetExtents();
+			Inertias[i] = FVector
+			{
+				(Angular.Mass * (BoxExtent.Y * BoxExtent.Y + BoxExtent.Z * BoxExtent.Z)) / FTether::MomentOfInertia,
+				(Angular.Mass * (BoxExtent.X * BoxExtent.X + BoxExtent.Z * BoxExtent.Z)) / FTether::MomentOfInertia,
+				(Angular.Mass * (BoxExtent.X * BoxExtent.X + BoxExtent.Y * BoxExtent.Y)) / FTether::MomentOfInertia
+			};
+		}
+		else
+		{
+			Inertias[i] = Angular.Inertia;
+		}
+	}
+}
+
+void FTetherBodyStore::GatherTransforms(const FTetherBodyRange& Range)
+{
+	for (int32 i = Range.Begin; i < Range.GetEnd(Num()); i++)
+	{
+		Positions[i] = Shapes[i]->GetAppliedWorldTransform().GetLocation();
+		Rotations[i] = Shapes[i]->GetAppliedWorldTransform().GetRotation();
+	}
+}
+
+void FTetherBodyStore::GatherVelocities(const FTetherBodyRange& Range)
+{
+	for (int32 i = Range.Begin; i < Range.GetEnd(Num()); i++)
+	{
+		LinearVelocities[i] = ShapeData[i]->LinearOutput.LinearVelocity;
+		AngularVelocities[i] = ShapeData[i]->AngularOutput.AngularVelocity;
+	}
+}
+
+void FTetherBodyStore::ScatterVelocities(const FTetherBodyRange& Range) const
+{
+	for (const int32 i : GetActiveBodies(Range))
+	{
+		ShapeData[i]->LinearOutput.LinearVelocity = LinearVelocities[i];
+		ShapeData[i]->AngularOutput.AngularVelocity = AngularVelocities[i];
+		ShapeData[i]->AngularOutput.Inertia = Inertias[i];
+	}
+}
+
+void FTetherBodyStore::ScatterTransform(int32 Index) const
+{
+	FTransform& Transform = ShapeData[Index]->IntegrationOutput.Transform;
+	Transform = Shapes[Index]->GetAppliedWorldTransform();
+	Transform.SetLocation(Positions[Index]);
+	Transform.SetRotation(Rotations[Index]);
+}
@@ -0,0 +1,176 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Physics/Solvers/TetherIslands.h"
+
+#include "TetherIO.h"
+#include "Algo/Unique.h"
+#include "Physics/Solvers/TetherBodyStore.h"
+#include "Shapes/TetherShape.h"
+#include "System/TetherVersioning.h"
+
+void FTetherIslands::Reset(int32 InNumBodies)
+{
+	NumBodies = InNumBodies;
+	
+	Parents.SetNumUninitialized(NumBodies);
+	Ranks.SetNumZeroed(NumBodies);
+	for (int32 i = 0; i < NumBodies; i++)
+	{
+		Parents[i] = i;
+	}
+	
+	BodyIslands.Reset();
+	IslandBodies.Reset();
+	IslandStarts.Reset();
+	ActiveIslands.Reset();
+}
+
+void FTetherIslands::AddEdge(const FTetherBodyStore& Bodies, int32 BodyA, int32 BodyB)
+{
+	if (!Parents.IsValidIndex(BodyA) || !Parents.IsValidIndex(BodyB) || BodyA == BodyB)
+	{
+		return;
+	}
+
+	// Kinematic bodies are driven externally and don't transmit anything between the bodies touching them
+	if (Bodies.Shapes[BodyA]->SimulationMode == ETetherSimulationMode::Kinematic ||
+		Bodies.Shapes[BodyB]->SimulationMode == ETetherSimulationMode::Kinematic)
+	{
+		return;
+	}
+
+	Union(BodyA, BodyB);
+}
+
+void FTetherIslands::AddContacts(const FTetherBodyStore& Bodies, TConstArrayView<FNarrowPhaseCollision> Collisions)
+{
+	for (const FNarrowPhaseCollision& Collision : Collisions)
+	{
+		if (Collision.ShapeA && Collision.ShapeB)
+		{
+			AddEdge(Bodies, Collision.ShapeA->SimulationIndex, Collision.ShapeB->SimulationIndex);
+		}
+	}
+}
+
+void FTetherIslands::Finalize()
+{
+	// Assign an island to each root, in body order so islands are deterministic
+	BodyIslands.SetNumUninitialized(NumBodies);
+	TArray<int32> RootIslands;
+	RootIslands.Init(INDEX_NONE, NumBodies);
+	
+	int32 NumIslands = 0;
+	for (int32 i = 0; i < NumBodies; i++)
+	{
+		int32& RootIsland = RootIslands[Find(i)];
+		if (RootIsland == INDEX_NONE)
+		{
+			RootIsland = NumIslands++;
+		}
+		BodyIslands[i] = RootIsland;
+	}
+
+	// Counting sort the bodies by island
+	IslandStarts.Init(0, NumIslands + 1);
+	for (int32 i = 0; i < NumBodies; i++)
+	{
+		IslandStarts[BodyIslands[i] + 1]++;
+	}
+	for (int32 Island = 0; Island < NumIslands; Island++)
+	{
+		IslandStarts[Island + 1] += IslandStarts[Island];
+	}
+
+	IslandBodies.SetNumUninitialized(NumBodies);
+	TArray<int32> Cursors(IslandStarts.GetData(), NumIslands);
+	for (int32 i = 0; i < NumBodies; i++)
+	{
+		IslandBodies[Cursors[BodyIslands[i]]++] = i;
+	}
+}
+
+void FTetherIslands::Build(const FTetherBodyStore& Bodies, TConstArrayView<FNarrowPhaseCollision> Collisions)
+{
+	// Keep the previous islands, sleeping bodies generate no contacts with each other
+	TArray<int32> PreviousIslands;
+	const int32 NumPreviousIslands = IsValidFor(Bodies.Num()) ? Num() : 0;
+	if (NumPreviousIslands > 0)
+	{
+		Swap(PreviousIslands, BodyIslands);
+	}
+	
+	Reset(Bodies.Num());
+	AddContacts(Bodies, Collisions);
+
+	// Rejoin the sleeping bodies that shared an island, so a resting pile still wakes as a unit
+	if (NumPreviousIslands > 0)
+	{
+		TArray<int32> FirstAsleep;
+		FirstAsleep.Init(INDEX_NONE, NumPreviousIslands);
+		for (const int32 i : Bodies.AsleepBodies)
+		{
+			int32& First = FirstAsleep[PreviousIslands[i]];
+			if (First == INDEX_NONE)
+			{
+				First = i;
+			}
+			else
+			{
+				AddEdge(Bodies, First, i);
+			}
+		}
+	}
+	
+	Finalize();
+}
+
+void FTetherIslands::GatherActive(TConstArrayView<int32> Bodies)
+{
+	ActiveIslands.Reset();
+	for (const int32 Body : Bodies)
+	{
+		ActiveIslands.Add(BodyIslands[Body]);
+	}
+
+	// Sorted for deterministic ordering, each island only once
+	ActiveIslands.Sort();
+#if UE_5_04_OR_LATER
+	ActiveIslands.SetNum(Algo::Unique(ActiveIslands), EAllowShrinking::No);
+#else
+	ActiveIslands.SetNum(Algo::Unique(ActiveIslands), false);
+#endif
+}
+
+int32 FTetherIslands::Find(int32 Body)
+{
+	while (Parents[Body] != Body)
+	{
+		// Path halving, point every other node at its grandparent
+		Parents[Body] = Parents[Parents[Body]];
+		Body = Parents[Body];
+	}
+	return Body;
+}
+
+void FTetherIslands::Union(int32 BodyA, int32 BodyB)
+{
+	int32 RootA = Find(BodyA);
+	int32 RootB = Find(BodyB);
+	if (RootA == RootB)
+	{
+		return;
+	}
+
+	// Attach the shallower tree beneath the deeper one
+	if (Ranks[RootA] < Ranks[RootB])
+	{
+		Swap(RootA, RootB);
+	}
+	Parents[RootB] = RootA;
+	if (Ranks[RootA] == Ranks[RootB])
+	{
+		Ranks[RootA]++;
+	}
+}
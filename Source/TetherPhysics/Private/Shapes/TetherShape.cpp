@@ -49,17 +49,96 @@ bool FTetherShape::AreShapesIgnoringEachOther(const FTetherShape& ShapeA, const
 	return ShapeA.IsIgnored(ShapeB) || ShapeB.IsIgnored(ShapeA);
 }
 
+void FTetherShape::ResolveShapeTypeId()
+{
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(GetShapeType());
+}
+
+uint32 FTetherShape::ComputeCollisionFilterHash() const
+{
+	uint32 Hash = GetTypeHash(GetShapeType());
+	for (const FGameplayTag& ShapeType : IgnoredShapeTypes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(ShapeType));
+	}
+	for (const TWeakObjectPtr<UTetherShapeObject>& ShapeObject : IgnoredShapes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(ShapeObject));
+	}
+	return Hash;
+}
+
+void FTetherShape::ResolveCollisionFilter()
+{
+	static_assert(FTetherShapeTypeRegistry::MaxShapeTypes <= 32, "Collision groups are stored as one bit per shape type");
+
+	CollisionGroup = 0;
+	CollisionMask = 0;
+	CollisionFilterHash = ComputeCollisionFilterHash();
+	bCollisionFilterResolved = true;
+
+	// Custom shapes don't resolve their type ID on construction
+	ResolveShapeTypeId();
+
+	const uint8 TypeId = GetShapeTypeId();
+	if (!IsValid() || !FTetherShapeTypeRegistry::IsValidId(TypeId))
+	{
+		return;
+	}
+
+	CollisionGroup = 1u << TypeId;
+	CollisionMask = MAX_uint32;
+
+	auto IgnoreShapeType = [this](const FGameplayTag& ShapeType)
+	{
+		const uint8 IgnoredTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(ShapeType);
+		if (FTetherShapeTypeRegistry::IsValidId(IgnoredTypeId))
+		{
+			CollisionMask &= ~(1u << IgnoredTypeId);
+		}
+	};
+
+	for (const FGameplayTag& ShapeType : IgnoredShapeTypes)
+	{
+		IgnoreShapeType(ShapeType);
+	}
+
+	// Shape objects are shared by every shape of their type
+	for (const TWeakObjectPtr<UTetherShapeObject>& ShapeObject : IgnoredShapes)
+	{
+		if (ShapeObject.IsValid())
+		{
+			IgnoreShapeType(ShapeObject->GetShapeType());
+		}
+	}
+}
+
 void FTetherShape::ToWorldSpace(const FTransform& InWorldTransform)
 {
 	GetTetherShapeObject()->TransformToWorldSpace(*this, InWorldTransform);
 	bWorldSpace = true;
 	AppliedWorldTransform = InWorldTransform;
+	UpdateBounds();
 }
 
 void FTetherShape::ToLocalSpace()
 {
 	GetTetherShapeObject()->TransformToLocalSpace(*this);
 	bWorldSpace = false;
+	UpdateBounds();
+}
+
+void FTetherShape::UpdateBounds()
+{
+	if (const UTetherShapeObject* ShapeObject = GetTetherShapeObject())
+	{
+		Bounds = ShapeObject->ComputeBounds(*this);
+	}
+}
+
+FVector FTetherShape::GetSupportPoint(const FVector& Direction) const
+{
+	return GetTetherShapeObject() ? GetTetherShapeObject()->GetSupportPoint(*this, Direction) : GetBounds().Center;
 }
 
 void FTetherShape::DrawDebug(const UWorld* World, FAnimInstanceProxy* Proxy, const FColor& Color,
@@ -70,7 +149,110 @@ void FTetherShape::DrawDebug(const UWorld* World, FAnimInstanceProxy* Proxy, con
 #endif
 }
 
+void FTetherCollisionIgnoreMatrix::Ignore(FTetherShape* ShapeA, FTetherShape* ShapeB)
+{
+	if (ensure(ShapeA && ShapeB && ShapeA != ShapeB))
+	{
+		bool bAlreadyIgnored = false;
+		IgnoredPairs.Add(FTetherShapePair(ShapeA, ShapeB), &bAlreadyIgnored);
+		bDirty |= !bAlreadyIgnored;
+	}
+}
+
+void FTetherCollisionIgnoreMatrix::SetIgnoredPairs(TSet<FTetherShapePair>&& InIgnoredPairs)
+{
+	if (InIgnoredPairs.Num() != IgnoredPairs.Num() || !InIgnoredPairs.Includes(IgnoredPairs))
+	{
+		IgnoredPairs = MoveTemp(InIgnoredPairs);
+		bDirty = true;
+	}
+}
+
+void FTetherCollisionIgnoreMatrix::RemoveShape(const FTetherShape* Shape)
+{
+	for (auto It = IgnoredPairs.CreateIterator(); It; ++It)
+	{
+		if (It->ContainsShape(Shape))
+		{
+			It.RemoveCurrent();
+			bDirty = true;
+		}
+	}
+}
+
+void FTetherCollisionIgnoreMatrix::Reset()
+{
+	IgnoredPairs.Reset();
+	BuiltShapes.Reset();
+	Bits.Empty();
+	NumShapes = 0;
+	NumIgnored = 0;
+	bDirty = true;
+}
+
+void FTetherCollisionIgnoreMatrix::Build(const TArray<FTetherShape*>& Shapes)
+{
+	// Nothing to rebuild unless the exclusions changed or a shape moved to a different SimulationIndex
+	bool bShapesChanged = BuiltShapes.Num() != Shapes.Num();
+	for (int32 i = 0; i < Shapes.Num() && !bShapesChanged; i++)
+	{
+		bShapesChanged = BuiltShapes[i] != Shapes[i];
+	}
+	if (!bDirty && !bShapesChanged)
+	{
+		return;
+	}
+
+	bDirty = false;
+	BuiltShapes = TArray<const FTetherShape*>(Shapes);
+	NumShapes = Shapes.Num();
+	NumIgnored = 0;
+
+	if (IgnoredPairs.IsEmpty())
+	{
+		Bits.Empty();
+		return;
+	}
+
+	// Look the shapes up by address rather than dereferencing them, a pair may outlive its shapes
+	TMap<const FTetherShape*, int32> ShapeIndices;
+	ShapeIndices.Reserve(NumShapes);
+	for (int32 i = 0; i < NumShapes; i++)
+	{
+		ShapeIndices.Add(Shapes[i], i);
+	}
+
+	Bits.Init(false, NumShapes * NumShapes);
+	for (const FTetherShapePair& Pair : IgnoredPairs)
+	{
+		// Pairs whose shapes aren't part of this simulation are kept, but can't be ignored
+		const int32* IndexA = ShapeIndices.Find(Pair.ShapeA);
+		const int32* IndexB = ShapeIndices.Find(Pair.ShapeB);
+		if (IndexA && IndexB)
+		{
+			Bits[*IndexA * NumShapes + *IndexB] = true;
+			Bits[*IndexB * NumShapes + *IndexA] = true;
+			NumIgnored++;
+		}
+	}
+}
+
 FTetherShape_AxisAlignedBoundingBox UTetherShapeObject::GetBoundingBox(const FTetherShape& Shape) const
 {
 	return FTetherShape_AxisAlignedBoundingBox();
 }
+
+FTetherShapeBounds UTetherShapeObject::ComputeBounds(const FTetherShape& Shape) const
+{
+	const FTetherShape_AxisAlignedBoundingBox AABB = GetBoundingBox(Shape);
+	return { AABB.Min, AABB.Max };
+}
+
+FVector UTetherShapeObject::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const FTetherShapeBounds& Bounds = Shape.GetBounds();
+	return FVector(
+		Direction.X >= 0.f ? Bounds.Max.X : Bounds.Min.X,
+		Direction.Y >= 0.f ? Bounds.Max.Y : Bounds.Min.Y,
+		Direction.Z >= 0.f ? Bounds.Max.Z : Bounds.Min.Z);
+}
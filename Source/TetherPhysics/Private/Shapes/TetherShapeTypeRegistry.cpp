@@ -0,0 +1,64 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+
+#include "Shapes/TetherShapeTypeRegistry.h"
+
+#include "TetherGameplayTags.h"
+
+namespace FTetherShapeTypeRegistryPrivate
+{
+	static FCriticalSection Mutex;
+
+	static TArray<FGameplayTag>& GetShapeTypes()
+	{
+		// Built-in shapes always occupy the lowest IDs
+		static TArray<FGameplayTag> ShapeTypes = {
+			FTetherGameplayTags::Tether_Shape_AxisAlignedBoundingBox,
+			FTetherGameplayTags::Tether_Shape_BoundingSphere,
+			FTetherGameplayTags::Tether_Shape_OrientedBoundingBox,
+			FTetherGameplayTags::Tether_Shape_Capsule,
+			FTetherGameplayTags::Tether_Shape_Pipe,
+			FTetherGameplayTags::Tether_Shape_ConvexHull,
+			FTetherGameplayTags::Tether_Shape_Compound,
+		};
+		return ShapeTypes;
+	}
+}
+
+uint8 FTetherShapeTypeRegistry::GetShapeTypeId(const FGameplayTag& ShapeType)
+{
+	if (!ShapeType.IsValid())
+	{
+		return InvalidShapeTypeId;
+	}
+
+	FScopeLock Lock(&FTetherShapeTypeRegistryPrivate::Mutex);
+
+	TArray<FGameplayTag>& ShapeTypes = FTetherShapeTypeRegistryPrivate::GetShapeTypes();
+	const int32 Index = ShapeTypes.IndexOfByKey(ShapeType);
+	if (Index != INDEX_NONE)
+	{
+		return static_cast<uint8>(Index);
+	}
+
+	if (!ensureMsgf(ShapeTypes.Num() < MaxShapeTypes, TEXT("Too many shape types registered, increase FTetherShapeTypeRegistry::MaxShapeTypes to register %s"), *ShapeType.ToString()))
+	{
+		return InvalidShapeTypeId;
+	}
+
+	return static_cast<uint8>(ShapeTypes.Add(ShapeType));
+}
+
+FGameplayTag FTetherShapeTypeRegistry::GetShapeType(uint8 ShapeTypeId)
+{
+	FScopeLock Lock(&FTetherShapeTypeRegistryPrivate::Mutex);
+
+	const TArray<FGameplayTag>& ShapeTypes = FTetherShapeTypeRegistryPrivate::GetShapeTypes();
+	return ShapeTypes.IsValidIndex(ShapeTypeId) ? ShapeTypes[ShapeTypeId] : FGameplayTag::EmptyTag;
+}
+
+int32 FTetherShapeTypeRegistry::Num()
+{
+	FScopeLock Lock(&FTetherShapeTypeRegistryPrivate::Mutex);
+	return FTetherShapeTypeRegistryPrivate::GetShapeTypes().Num();
+}
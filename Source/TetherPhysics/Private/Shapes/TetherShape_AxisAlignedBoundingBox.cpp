@@ -14,13 +14,13 @@ FTetherShape_AxisAlignedBoundingBox::FTetherShape_AxisAlignedBoundingBox(const F
 	, Max(InMax)
 {
 	TetherShapeClass = UTetherShapeObject_AxisAlignedBoundingBox::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
 
 	// Caching initial local space data is required both for AABB being created to represent the bounds of other shapes,
 	// and also for duplication
-	if (!IsWorldSpace())
-	{
-		LocalSpaceData = MakeShared<FTetherShape_AxisAlignedBoundingBox>(*this);
-	}
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
 
 	// Bounding boxes are created from other shapes,
 	// special handling is required when a world space shape wants a bounding box vs a local space shape
@@ -32,17 +32,26 @@ FTetherShape_AxisAlignedBoundingBox::FTetherShape_AxisAlignedBoundingBox(const F
 	}
 }
 
+void FTetherShape_AxisAlignedBoundingBox::CaptureLocalSpace()
+{
+	LocalSpace.Min = Min;
+	LocalSpace.Max = Max;
+}
+
 void FTetherShape_AxisAlignedBoundingBox::ToLocalSpace_Implementation()
 {
 	if (!IsWorldSpace())
 	{
 		return;
 	}
-	
-	if (ensure(LocalSpaceData.IsValid()))
-	{
-		*this = *StaticCastSharedPtr<FTetherShape_AxisAlignedBoundingBox>(LocalSpaceData);
-	}
+
+	Min = LocalSpace.Min;
+	Max = LocalSpace.Max;
+}
+
+FTetherShapeBounds FTetherShape_AxisAlignedBoundingBox::ComputeBounds() const
+{
+	return { Min, Max };
 }
 
 FVector FTetherShape_AxisAlignedBoundingBox::ComputeCenter() const
@@ -54,11 +63,8 @@ FVector UTetherShapeObject_AxisAlignedBoundingBox::GetLocalSpaceShapeCenter(cons
 {
 	if (Shape.IsWorldSpace())
 	{
-		if (ensureAlways(Shape.LocalSpaceData.IsValid()))
-		{
-			const auto* LocalAABB = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(Shape.LocalSpaceData.Get());
-			return LocalAABB->ComputeCenter();
-		}
+		const auto* AABB = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(&Shape);
+		return (AABB->LocalSpace.Min + AABB->LocalSpace.Max) * 0.5f;
 	}
 	else
 	{
@@ -75,30 +81,27 @@ void UTetherShapeObject_AxisAlignedBoundingBox::TransformToWorldSpace(FTetherSha
 	if (Shape.IsWorldSpace())
 	{
 		// Already in world space
-		if (!Shape.GetAppliedWorldTransform().Equals(WorldTransform))
-		{
-			// Transform has changed, revert to world first
-			TransformToLocalSpace(Shape);
-		}
-		else
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
 		{
 			// No changes required
 			return;
 		}
 	}
-
-	if (!Shape.IsWorldSpace())
+	else
 	{
 		// Cache local space data
-		Shape.LocalSpaceData = Shape.Clone();
+		AABB->CaptureLocalSpace();
 	}
 
+	// Compute the world space data directly from the local space data
+	const FTetherAABBLocalSpace& Local = AABB->LocalSpace;
+
 	// Extract the scale from the WorldTransform
 	FVector Scale = WorldTransform.GetScale3D();
 
 	// Apply the scale to the Min and Max points of the AABB
-	FVector ScaledMin = AABB->Min * Scale;
-	FVector ScaledMax = AABB->Max * Scale;
+	FVector ScaledMin = Local.Min * Scale;
+	FVector ScaledMax = Local.Max * Scale;
 	
 	// Transform both the min and max points
 	FTransform Transform = WorldTransform;
@@ -135,6 +138,12 @@ FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_AxisAlignedBoundingBox::G
 	return *AABB;
 }
 
+FTetherShapeBounds UTetherShapeObject_AxisAlignedBoundingBox::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* AABB = FTetherShapeCaster::CastChecked<FTetherShape_AxisAlignedBoundingBox>(&Shape);
+	return AABB->ComputeBounds();
+}
+
 void UTetherShapeObject_AxisAlignedBoundingBox::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy,
 	const UWorld* World, const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
 {
@@ -14,12 +14,18 @@ FTetherShape_BoundingSphere::FTetherShape_BoundingSphere(const FVector& InCenter
 	, Radius(InRadius)
 {
 	TetherShapeClass = UTetherShapeObject_BoundingSphere::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
 
 	// Caching initial local space data is required for duplication
-	if (!IsWorldSpace())
-	{
-		LocalSpaceData = MakeShared<FTetherShape_BoundingSphere>(*this);
-	}
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
+}
+
+void FTetherShape_BoundingSphere::CaptureLocalSpace()
+{
+	LocalSpace.Center = Center;
+	LocalSpace.Radius = Radius;
 }
 
 void FTetherShape_BoundingSphere::ToLocalSpace_Implementation()
@@ -28,26 +34,27 @@ void FTetherShape_BoundingSphere::ToLocalSpace_Implementation()
 	{
 		return;
 	}
-	
-	if (ensure(LocalSpaceData.IsValid()))
-	{
-		*this = *StaticCastSharedPtr<FTetherShape_BoundingSphere>(LocalSpaceData);
-	}
+
+	Center = LocalSpace.Center;
+	Radius = LocalSpace.Radius;
 }
 
-FTetherShape_AxisAlignedBoundingBox FTetherShape_BoundingSphere::GetBoundingBox() const
+FTetherShapeBounds FTetherShape_BoundingSphere::ComputeBounds() const
 {
-	// Calculate the min and max extents of the AABB
-	FVector Min = Center - FVector(Radius);
-	FVector Max = Center + FVector(Radius);
+	// The sphere is its own bounding sphere
+	return { Center, Radius };
+}
 
-	return FTetherShape_AxisAlignedBoundingBox(Min, Max, IsWorldSpace(), AppliedWorldTransform);
+FTetherShape_AxisAlignedBoundingBox FTetherShape_BoundingSphere::GetBoundingBox() const
+{
+	const FTetherShapeBounds SphereBounds = ComputeBounds();
+	return FTetherShape_AxisAlignedBoundingBox(SphereBounds.Min, SphereBounds.Max, IsWorldSpace(), AppliedWorldTransform);
 }
 
 FVector UTetherShapeObject_BoundingSphere::GetLocalSpaceShapeCenter(const FTetherShape& Shape) const
 {
 	const auto* Sphere = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(&Shape);
-	return Sphere->Center;
+	return Shape.IsWorldSpace() ? Sphere->LocalSpace.Center : Sphere->Center;
 }
 
 void UTetherShapeObject_BoundingSphere::TransformToWorldSpace(FTetherShape& Shape, const FTransform& WorldTransform) const
@@ -57,31 +64,28 @@ void UTetherShapeObject_BoundingSphere::TransformToWorldSpace(FTetherShape& Shap
 	if (Shape.IsWorldSpace())
 	{
 		// Already in world space
-		if (!Shape.GetAppliedWorldTransform().Equals(WorldTransform))
-		{
-			// Transform has changed, revert to world first
-			TransformToLocalSpace(Shape);
-		}
-		else
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
 		{
 			// No changes required
 			return;
 		}
 	}
-
-	if (!Shape.IsWorldSpace())
+	else
 	{
 		// Cache local space data
-		Shape.LocalSpaceData = Shape.Clone();
+		Sphere->CaptureLocalSpace();
 	}
 
+	// Compute the world space data directly from the local space data
+	const FTetherBoundingSphereLocalSpace& Local = Sphere->LocalSpace;
+
 	// Transform the center to world space
-	FVector TransformedCenter = WorldTransform.TransformPosition(Sphere->Center);
+	FVector TransformedCenter = WorldTransform.TransformPosition(Local.Center);
 
 	// Scale the radius based on the scale of the world transform
 	FVector Scale = WorldTransform.GetScale3D();
 	float MaxScale = FMath::Max(Scale.X, FMath::Max(Scale.Y, Scale.Z));
-	float TransformedRadius = Sphere->Radius * MaxScale;
+	float TransformedRadius = Local.Radius * MaxScale;
 
 	// Update the sphere with the transformed values
 	Sphere->Center = TransformedCenter;
@@ -106,6 +110,18 @@ FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_BoundingSphere::GetBoundi
 	return BoundingSphere->GetBoundingBox();
 }
 
+FTetherShapeBounds UTetherShapeObject_BoundingSphere::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* BoundingSphere = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(&Shape);
+	return BoundingSphere->ComputeBounds();
+}
+
+FVector UTetherShapeObject_BoundingSphere::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const auto* BoundingSphere = FTetherShapeCaster::CastChecked<FTetherShape_BoundingSphere>(&Shape);
+	return BoundingSphere->Center + Direction.GetSafeNormal() * BoundingSphere->Radius;
+}
+
 void UTetherShapeObject_BoundingSphere::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy,
 	const UWorld* World, const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
 {
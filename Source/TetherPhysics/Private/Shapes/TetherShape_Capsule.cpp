@@ -14,12 +14,20 @@ FTetherShape_Capsule::FTetherShape_Capsule(const FVector& InCenter, float InHalf
 	, Rotation(InRotation)
 {
 	TetherShapeClass = UTetherShapeObject_Capsule::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
 
 	// Caching initial local space data is required for duplication
-	if (!IsWorldSpace())
-	{
-		LocalSpaceData = MakeShared<FTetherShape_Capsule>(*this);
-	}
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
+}
+
+void FTetherShape_Capsule::CaptureLocalSpace()
+{
+	LocalSpace.Center = Center;
+	LocalSpace.HalfHeight = HalfHeight;
+	LocalSpace.Radius = Radius;
+	LocalSpace.Rotation = Rotation;
 }
 
 void FTetherShape_Capsule::ToLocalSpace_Implementation()
@@ -28,14 +36,14 @@ void FTetherShape_Capsule::ToLocalSpace_Implementation()
 	{
 		return;
 	}
-	
-	if (ensure(LocalSpaceData.IsValid()))
-	{
-		*this = *StaticCastSharedPtr<FTetherShape_Capsule>(LocalSpaceData);
-	}
+
+	Center = LocalSpace.Center;
+	HalfHeight = LocalSpace.HalfHeight;
+	Radius = LocalSpace.Radius;
+	Rotation = LocalSpace.Rotation;
 }
 
-FTetherShape_AxisAlignedBoundingBox FTetherShape_Capsule::GetBoundingBox() const
+FTetherShapeBounds FTetherShape_Capsule::ComputeBounds() const
 {
 	// Calculate the top and bottom points of the capsule
 	FVector Up = Rotation.RotateVector(FVector(0, 0, HalfHeight));
@@ -49,7 +57,13 @@ FTetherShape_AxisAlignedBoundingBox FTetherShape_Capsule::GetBoundingBox() const
 	Min -= FVector(Radius, Radius, 0.0f);
 	Max += FVector(Radius, Radius, 0.0f);
 
-	return FTetherShape_AxisAlignedBoundingBox(Min, Max, IsWorldSpace(), AppliedWorldTransform);
+	return { Min, Max };
+}
+
+FTetherShape_AxisAlignedBoundingBox FTetherShape_Capsule::GetBoundingBox() const
+{
+	const FTetherShapeBounds CapsuleBounds = ComputeBounds();
+	return FTetherShape_AxisAlignedBoundingBox(CapsuleBounds.Min, CapsuleBounds.Max, IsWorldSpace(), AppliedWorldTransform);
 }
 
 
@@ -57,11 +71,8 @@ FVector UTetherShapeObject_Capsule::GetLocalSpaceShapeCenter(const FTetherShape&
 {
 	if (Shape.IsWorldSpace())
 	{
-		if (ensureAlways(Shape.LocalSpaceData.IsValid()))
-		{
-			const auto* LocalCapsule = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(Shape.LocalSpaceData.Get());
-			return LocalCapsule->Center;
-		}
+		const auto* Capsule = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(&Shape);
+		return Capsule->LocalSpace.Center;
 	}
 	else
 	{
@@ -78,44 +89,41 @@ void UTetherShapeObject_Capsule::TransformToWorldSpace(FTetherShape& Shape, cons
 	if (Shape.IsWorldSpace())
 	{
 		// Already in world space
-		if (!Shape.GetAppliedWorldTransform().Equals(WorldTransform))
-		{
-			// Transform has changed, revert to world first
-			TransformToLocalSpace(Shape);
-		}
-		else
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
 		{
 			// No changes required
 			return;
 		}
 	}
-
-	if (!Shape.IsWorldSpace())
+	else
 	{
 		// Cache local space data
-		Shape.LocalSpaceData = Shape.Clone();
+		Capsule->CaptureLocalSpace();
 	}
 
+	// Compute the world space data directly from the local space data
+	const FTetherCapsuleLocalSpace& Local = Capsule->LocalSpace;
+
 	// Transform the center to world space
-	FVector TransformedCenter = WorldTransform.TransformPosition(Capsule->Center);
+	FVector TransformedCenter = WorldTransform.TransformPosition(Local.Center);
 
 	// Apply scaling to the half-height and radius based on the scale of the world transform
 	FVector Scale = WorldTransform.GetScale3D();
 
 	// Use Z scale for HalfHeight if capsule is aligned along Z-axis
-	float TransformedHalfHeight = Capsule->HalfHeight * Scale.Z;
+	float TransformedHalfHeight = Local.HalfHeight * Scale.Z;
 
 	// Use average of X and Y scales for the radius (assuming cylindrical symmetry)
-	float TransformedRadius = Capsule->Radius * FMath::Sqrt(Scale.X * Scale.Y);
+	float TransformedRadius = Local.Radius * FMath::Sqrt(Scale.X * Scale.Y);
 
 	// Apply the rotation
-	FRotator TransformedRotation = WorldTransform.GetRotation().Rotator() + Capsule->Rotation;
+	FQuat TransformedRotation = WorldTransform.GetRotation() * Local.Rotation.Quaternion();
 
 	// Update the capsule with the transformed values
 	Capsule->Center = TransformedCenter;
 	Capsule->HalfHeight = TransformedHalfHeight;
 	Capsule->Radius = TransformedRadius;
-	Capsule->Rotation = TransformedRotation;
+	Capsule->Rotation = TransformedRotation.Rotator();
 }
 
 void UTetherShapeObject_Capsule::TransformToLocalSpace(FTetherShape& Shape) const
@@ -136,6 +144,23 @@ FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_Capsule::GetBoundingBox(c
 	return Capsule->GetBoundingBox();
 }
 
+FTetherShapeBounds UTetherShapeObject_Capsule::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* Capsule = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(&Shape);
+	return Capsule->ComputeBounds();
+}
+
+FVector UTetherShapeObject_Capsule::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const auto* Capsule = FTetherShapeCaster::CastChecked<FTetherShape_Capsule>(&Shape);
+
+	// Furthest end of the segment, swept by the radius
+	FVector Bottom, Top;
+	Capsule->GetSegment(Bottom, Top);
+	const FVector& End = ((Top - Bottom) | Direction) >= 0.f ? Top : Bottom;
+	return End + Direction.GetSafeNormal() * Capsule->Radius;
+}
+
 void UTetherShapeObject_Capsule::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 	const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
 {
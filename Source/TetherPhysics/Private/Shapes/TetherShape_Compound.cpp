@@ -0,0 +1,287 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#include "Shapes/TetherShape_Compound.h"
+
+#include "Shapes/TetherShapeCaster.h"
+#include "System/TetherVersioning.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherShape_Compound)
+
+namespace FTetherCompoundPrivate
+{
+	static FTetherShapeBounds Union(const FTetherShapeBounds& A, const FTetherShapeBounds& B)
+	{
+		return { A.Min.ComponentMin(B.Min), A.Max.ComponentMax(B.Max) };
+	}
+}
+
+FTetherShape_Compound::FTetherShape_Compound()
+{
+	TetherShapeClass = UTetherShapeObject_Compound::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
+
+	BuildTree();
+
+	// Caching initial local space data is required for duplication
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
+}
+
+bool FTetherShape_Compound::IsCompound(const FTetherShape& Shape)
+{
+	static const uint8 CompoundId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
+	return Shape.GetShapeTypeId() == CompoundId;
+}
+
+void FTetherShape_Compound::CaptureLocalSpace()
+{
+	LocalSpace.Center = Nodes.Num() > 0 ? Nodes[0].Bounds.Center : FVector::ZeroVector;
+}
+
+FTetherShapeBounds FTetherShape_Compound::ComputeBounds() const
+{
+	return Nodes.Num() > 0 ? Nodes[0].Bounds : FTetherShapeBounds();
+}
+
+FTetherShape_AxisAlignedBoundingBox FTetherShape_Compound::GetBoundingBox() const
+{
+	const FTetherShapeBounds CompoundBounds = ComputeBounds();
+	return FTetherShape_AxisAlignedBoundingBox(CompoundBounds.Min, CompoundBounds.Max, IsWorldSpace(), AppliedWorldTransform);
+}
+
+void FTetherShape_Compound::BuildTree()
+{
+	Nodes.Reset();
+
+	const int32 Num = NumChildren();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	TArray<int32> Children;
+	Children.SetNumUninitialized(Num);
+	for (int32 i = 0; i < Num; i++)
+	{
+		Children[i] = i;
+		GetChild(i).UpdateBounds();
+	}
+
+	// A binary tree with one leaf per child
+	Nodes.Reserve(Num * 2 - 1);
+	BuildNode(Children, 0, Num);
+	RefitTree();
+}
+
+int32 FTetherShape_Compound::BuildNode(TArray<int32>& Children, int32 First, int32 Count)
+{
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	if (Count == 1)
+	{
+		Nodes[NodeIndex].Child = Children[First];
+		return NodeIndex;
+	}
+
+	// Split at the median along the longest axis of the children's centers
+	FBox Centers(ForceInit);
+	for (int32 i = First; i < First + Count; i++)
+	{
+		Centers += GetChild(Children[i]).GetBounds().Center;
+	}
+
+	const FVector Size = Centers.GetSize();
+	const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : (Size.Y >= Size.Z ? 1 : 2);
+	TArrayView<int32>(Children.GetData() + First, Count).Sort([this, Axis](int32 A, int32 B)
+	{
+		return GetChild(A).GetBounds().Center[Axis] < GetChild(B).GetBounds().Center[Axis];
+	});
+
+	// The left subtree immediately follows this node
+	const int32 Half = Count / 2;
+	BuildNode(Children, First, Half);
+	const int32 Right = BuildNode(Children, First + Half, Count - Half);
+	Nodes[NodeIndex].Right = Right;
+	return NodeIndex;
+}
+
+void FTetherShape_Compound::RefitTree()
+{
+	// Nodes are depth first, so walking backwards visits every node after the nodes beneath it
+	for (int32 i = Nodes.Num() - 1; i >= 0; i--)
+	{
+		FTetherCompoundNode& Node = Nodes[i];
+		Node.Bounds = Node.IsLeaf() ? GetChild(Node.Child).GetBounds() :
+			FTetherCompoundPrivate::Union(Nodes[i + 1].Bounds, Nodes[Node.Right].Bounds);
+	}
+}
+
+void FTetherShape_Compound::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		BuildTree();
+		CaptureLocalSpace();
+		Bounds = ComputeBounds();
+	}
+}
+
+FTetherShape& FTetherShape_Compound::GetChild(int32 Index)
+{
+	if (Spheres.IsValidIndex(Index))
+	{
+		return Spheres[Index];
+	}
+	Index -= Spheres.Num();
+
+	if (Capsules.IsValidIndex(Index))
+	{
+		return Capsules[Index];
+	}
+	Index -= Capsules.Num();
+
+	if (Boxes.IsValidIndex(Index))
+	{
+		return Boxes[Index];
+	}
+	Index -= Boxes.Num();
+
+	return ConvexHulls[Index];
+}
+
+void FTetherShape_Compound::ForEachOverlappingChild(const FTetherShapeBounds& InBounds,
+	TFunctionRef<void(const FTetherShape&)> Func) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<32>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+#if UE_5_04_OR_LATER
+		const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+#else
+		const int32 NodeIndex = Stack.Pop(false);
+#endif
+		const FTetherCompoundNode& Node = Nodes[NodeIndex];
+		if (!Node.Bounds.Intersects(InBounds))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			Func(GetChild(Node.Child));
+		}
+		else
+		{
+			Stack.Add(Node.Right);
+			Stack.Add(NodeIndex + 1);
+		}
+	}
+}
+
+FVector UTetherShapeObject_Compound::GetLocalSpaceShapeCenter(const FTetherShape& Shape) const
+{
+	const auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+	if (Shape.IsWorldSpace())
+	{
+		return Compound->LocalSpace.Center;
+	}
+	return Compound->ComputeBounds().Center;
+}
+
+void UTetherShapeObject_Compound::TransformToWorldSpace(FTetherShape& Shape, const FTransform& WorldTransform) const
+{
+	auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+
+	if (Shape.IsWorldSpace())
+	{
+		// Already in world space
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
+		{
+			// No changes required
+			return;
+		}
+	}
+	else
+	{
+		// Children added since the hierarchy was built, it must be built in local space
+		if (Compound->GetNodes().Num() != FMath::Max(0, Compound->NumChildren() * 2 - 1))
+		{
+			Compound->BuildTree();
+		}
+
+		// Cache local space data
+		Compound->CaptureLocalSpace();
+	}
+
+	// Each child computes its world space data from its own local space data, the topology doesn't change
+	for (int32 i = 0; i < Compound->NumChildren(); i++)
+	{
+		Compound->GetChild(i).ToWorldSpace(WorldTransform);
+	}
+	Compound->RefitTree();
+}
+
+void UTetherShapeObject_Compound::TransformToLocalSpace(FTetherShape& Shape) const
+{
+	if (!Shape.IsWorldSpace())
+	{
+		// Already there
+		return;
+	}
+
+	auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+	for (int32 i = 0; i < Compound->NumChildren(); i++)
+	{
+		Compound->GetChild(i).ToLocalSpace();
+	}
+	Compound->RefitTree();
+}
+
+FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_Compound::GetBoundingBox(const FTetherShape& Shape) const
+{
+	const auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+	return Compound->GetBoundingBox();
+}
+
+FTetherShapeBounds UTetherShapeObject_Compound::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+	return Compound->ComputeBounds();
+}
+
+FVector UTetherShapeObject_Compound::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+
+	FVector Best = Compound->ComputeBounds().Center;
+	double BestDistance = -UE_BIG_NUMBER;
+	for (int32 i = 0; i < Compound->NumChildren(); i++)
+	{
+		const FVector Support = Compound->GetChild(i).GetSupportPoint(Direction);
+		const double Distance = Support | Direction;
+		if (Distance > BestDistance)
+		{
+			BestDistance = Distance;
+			Best = Support;
+		}
+	}
+	return Best;
+}
+
+void UTetherShapeObject_Compound::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy,
+	const UWorld* World, const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
+{
+#if ENABLE_DRAW_DEBUG
+	const auto* Compound = FTetherShapeCaster::CastChecked<FTetherShape_Compound>(&Shape);
+	for (int32 i = 0; i < Compound->NumChildren(); i++)
+	{
+		Compound->GetChild(i).DrawDebug(World, Proxy, Color, bPersistentLines, LifeTime, Thickness);
+	}
+#endif
+}
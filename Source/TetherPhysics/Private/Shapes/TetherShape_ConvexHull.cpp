@@ -0,0 +1,454 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#include "Shapes/TetherShape_ConvexHull.h"
+
+#include "Shapes/TetherShapeCaster.h"
+#include "System/TetherDrawing.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TetherShape_ConvexHull)
+
+TSharedPtr<const FTetherConvexHullData> FTetherConvexHullData::Build(TConstArrayView<FVector> Points)
+{
+	if (Points.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// Scale the tolerance to the size of the point cloud
+	const FBox Box(Points.GetData(), Points.Num());
+	const float Tolerance = FMath::Max<float>(UE_KINDA_SMALL_NUMBER, Box.GetExtent().GetMax() * 1e-4f);
+
+	TArray<FVector> Unique;
+	Unique.Reserve(Points.Num());
+	for (const FVector& Point : Points)
+	{
+		if (!Unique.ContainsByPredicate([&Point, Tolerance](const FVector& Other) { return Other.Equals(Point, Tolerance); }))
+		{
+			Unique.Add(Point);
+		}
+	}
+
+	const TSharedRef<FTetherConvexHullData> Hull = MakeShared<FTetherConvexHullData>();
+
+	// Initial tetrahedron from the extreme points: the lowest X, the furthest from it, the furthest from that line,
+	// and the furthest from that plane
+	int32 Initial[4] = { 0, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	for (int32 i = 1; i < Unique.Num(); i++)
+	{
+		if (Unique[i].X < Unique[Initial[0]].X)
+		{
+			Initial[0] = i;
+		}
+	}
+
+	const auto FindFurthest = [&Unique, &Initial](int32 Slot, TFunctionRef<double(const FVector&)> Distance)
+	{
+		double Furthest = 0.0;
+		for (int32 i = 0; i < Unique.Num(); i++)
+		{
+			const double PointDistance = Distance(Unique[i]);
+			if (PointDistance > Furthest)
+			{
+				Furthest = PointDistance;
+				Initial[Slot] = i;
+			}
+		}
+		return Furthest;
+	};
+
+	const FVector& P0 = Unique[Initial[0]];
+	const bool bLine = FindFurthest(1, [&P0](const FVector& P) { return (P - P0).Size(); }) > Tolerance;
+	const FVector Line = bLine ? (Unique[Initial[1]] - P0).GetSafeNormal() : FVector::ZeroVector;
+	const bool bPlane = bLine && FindFurthest(2, [&P0, &Line](const FVector& P) { return ((P - P0) ^ Line).Size(); }) > Tolerance;
+	const FVector PlaneNormal = bPlane ? (Line ^ (Unique[Initial[2]] - P0)).GetSafeNormal() : FVector::ZeroVector;
+	const bool bVolume = bPlane && FindFurthest(3, [&P0, &PlaneNormal](const FVector& P) { return FMath::Abs((P - P0) | PlaneNormal); }) > Tolerance;
+
+	// Too flat for faces, every point is a vertex and support queries test them all
+	if (!bVolume)
+	{
+		Hull->Vertices = MoveTemp(Unique);
+		Hull->BuildFullAdjacency();
+		return Hull;
+	}
+
+	struct FFace
+	{
+		int32 Indices[3];
+		FPlane Plane;
+	};
+
+	// Every face is oriented away from a point inside the initial tetrahedron, which stays inside as the hull grows
+	const FVector Interior = (Unique[Initial[0]] + Unique[Initial[1]] + Unique[Initial[2]] + Unique[Initial[3]]) * 0.25;
+	TArray<FFace> Faces;
+	const auto AddFace = [&Unique, &Faces, &Interior](int32 A, int32 B, int32 C)
+	{
+		FVector Normal = ((Unique[B] - Unique[A]) ^ (Unique[C] - Unique[A])).GetSafeNormal();
+		if ((Normal | (Interior - Unique[A])) > 0.f)
+		{
+			Swap(B, C);
+			Normal = -Normal;
+		}
+		Faces.Add({ { A, B, C }, FPlane(Unique[A], Normal) });
+	};
+
+	AddFace(Initial[0], Initial[1], Initial[2]);
+	AddFace(Initial[0], Initial[1], Initial[3]);
+	AddFace(Initial[0], Initial[2], Initial[3]);
+	AddFace(Initial[1], Initial[2], Initial[3]);
+
+	// Add each point outside the hull, replacing the faces it can see with a fan to the horizon around them
+	TArray<TPair<int32, int32>> Horizon;
+	for (int32 Point = 0; Point < Unique.Num(); Point++)
+	{
+		Horizon.Reset();
+		for (int32 i = Faces.Num() - 1; i >= 0; i--)
+		{
+			if (Faces[i].Plane.PlaneDot(Unique[Point]) <= Tolerance)
+			{
+				continue;
+			}
+
+			// Edges shared by two visible faces are inside the removed region
+			for (int32 Edge = 0; Edge < 3; Edge++)
+			{
+				const int32 From = Faces[i].Indices[Edge];
+				const int32 To = Faces[i].Indices[(Edge + 1) % 3];
+				const TPair<int32, int32> Key(FMath::Min(From, To), FMath::Max(From, To));
+				const int32 Shared = Horizon.IndexOfByKey(Key);
+				if (Shared != INDEX_NONE)
+				{
+					Horizon.RemoveAtSwap(Shared);
+				}
+				else
+				{
+					Horizon.Add(Key);
+				}
+			}
+			Faces.RemoveAtSwap(i);
+		}
+
+		for (const TPair<int32, int32>& Edge : Horizon)
+		{
+			AddFace(Edge.Key, Edge.Value, Point);
+		}
+	}
+
+	// Keep only the points the faces use
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, Unique.Num());
+	TArray<TPair<int32, int32>> Edges;
+	for (FFace& Face : Faces)
+	{
+		for (int32& Index : Face.Indices)
+		{
+			if (Remap[Index] == INDEX_NONE)
+			{
+				Remap[Index] = Hull->Vertices.Add(Unique[Index]);
+			}
+			Index = Remap[Index];
+		}
+
+		for (int32 Edge = 0; Edge < 3; Edge++)
+		{
+			const int32 From = Face.Indices[Edge];
+			const int32 To = Face.Indices[(Edge + 1) % 3];
+			Edges.Emplace(From, To);
+			Edges.Emplace(To, From);
+		}
+
+		// Coplanar triangles share a plane
+		const bool bDuplicate = Hull->Planes.ContainsByPredicate([&Face, Tolerance](const FPlane& Plane)
+		{
+			return (Plane.GetNormal() | Face.Plane.GetNormal()) >= 1.f - UE_KINDA_SMALL_NUMBER && FMath::Abs(Plane.W - Face.Plane.W) <= Tolerance;
+		});
+		if (!bDuplicate)
+		{
+			Hull->Planes.Add(Face.Plane);
+		}
+	}
+
+	// Each edge appears once per direction per face, sorting groups the neighbors of each vertex
+	Edges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+	{
+		return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+	});
+
+	Hull->AdjacencyStarts.Init(0, Hull->Vertices.Num() + 1);
+	for (int32 i = 0; i < Edges.Num(); i++)
+	{
+		if (i > 0 && Edges[i] == Edges[i - 1])
+		{
+			continue;
+		}
+		Hull->Adjacency.Add(Edges[i].Value);
+		Hull->AdjacencyStarts[Edges[i].Key + 1]++;
+	}
+	for (int32 Vertex = 0; Vertex < Hull->Vertices.Num(); Vertex++)
+	{
+		Hull->AdjacencyStarts[Vertex + 1] += Hull->AdjacencyStarts[Vertex];
+	}
+
+	return Hull;
+}
+
+int32 FTetherConvexHullData::FindSupportVertex(const FVector& Direction, int32 StartVertex) const
+{
+	if (Vertices.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Best = Vertices.IsValidIndex(StartVertex) ? StartVertex : 0;
+	double BestDistance = Vertices[Best] | Direction;
+
+	// Each step strictly improves, the limit only guards against cycling on a malformed hull
+	for (int32 Step = 0; Step < Vertices.Num(); Step++)
+	{
+		const int32 Current = Best;
+		for (const int32 Neighbor : GetNeighbors(Current))
+		{
+			const double Distance = Vertices[Neighbor] | Direction;
+			if (Distance > BestDistance)
+			{
+				BestDistance = Distance;
+				Best = Neighbor;
+			}
+		}
+
+		if (Best == Current)
+		{
+			break;
+		}
+	}
+	return Best;
+}
+
+bool FTetherConvexHullData::IsInside(const FVector& Point, float Tolerance) const
+{
+	if (Planes.Num() == 0)
+	{
+		return false;
+	}
+
+	for (const FPlane& Plane : Planes)
+	{
+		if (Plane.PlaneDot(Point) > Tolerance)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FTetherConvexHullData::BuildFullAdjacency()
+{
+	const int32 NumVertices = Vertices.Num();
+	Adjacency.Reset(NumVertices * FMath::Max(0, NumVertices - 1));
+	AdjacencyStarts.Reset(NumVertices + 1);
+	for (int32 Vertex = 0; Vertex < NumVertices; Vertex++)
+	{
+		AdjacencyStarts.Add(Adjacency.Num());
+		for (int32 Neighbor = 0; Neighbor < NumVertices; Neighbor++)
+		{
+			if (Neighbor != Vertex)
+			{
+				Adjacency.Add(Neighbor);
+			}
+		}
+	}
+	AdjacencyStarts.Add(Adjacency.Num());
+}
+
+FTetherShape_ConvexHull::FTetherShape_ConvexHull()
+	: FTetherShape_ConvexHull(FVector::ZeroVector, {
+		FVector(-10.f, -10.f, -10.f), FVector(10.f, -10.f, -10.f), FVector(10.f, 10.f, -10.f), FVector(-10.f, 10.f, -10.f),
+		FVector(-10.f, -10.f, 10.f), FVector(10.f, -10.f, 10.f), FVector(10.f, 10.f, 10.f), FVector(-10.f, 10.f, 10.f)
+	}, FRotator::ZeroRotator)
+{}
+
+FTetherShape_ConvexHull::FTetherShape_ConvexHull(const FVector& InCenter, const TArray<FVector>& InPoints,
+	const FRotator& InRotation, const FVector& InScale)
+	: Center(InCenter)
+	, Rotation(InRotation)
+	, Scale(InScale)
+	, Points(InPoints)
+{
+	TetherShapeClass = UTetherShapeObject_ConvexHull::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
+
+	BuildHull();
+
+	// Caching initial local space data is required for duplication
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
+}
+
+void FTetherShape_ConvexHull::CaptureLocalSpace()
+{
+	LocalSpace.Center = Center;
+	LocalSpace.Rotation = Rotation;
+	LocalSpace.Scale = Scale;
+}
+
+void FTetherShape_ConvexHull::ToLocalSpace_Implementation()
+{
+	if (!IsWorldSpace())
+	{
+		return;
+	}
+
+	Center = LocalSpace.Center;
+	Rotation = LocalSpace.Rotation;
+	Scale = LocalSpace.Scale;
+}
+
+FTetherShapeBounds FTetherShape_ConvexHull::ComputeBounds() const
+{
+	if (!Hull.IsValid())
+	{
+		return { Center, Center };
+	}
+
+	// Support points along each axis, rather than transforming every vertex
+	const FVector Min(
+		GetSupportPoint(FVector::BackwardVector).X,
+		GetSupportPoint(FVector::LeftVector).Y,
+		GetSupportPoint(FVector::DownVector).Z);
+
+	const FVector Max(
+		GetSupportPoint(FVector::ForwardVector).X,
+		GetSupportPoint(FVector::RightVector).Y,
+		GetSupportPoint(FVector::UpVector).Z);
+
+	return { Min, Max };
+}
+
+FTetherShape_AxisAlignedBoundingBox FTetherShape_ConvexHull::GetBoundingBox() const
+{
+	const FTetherShapeBounds HullBounds = ComputeBounds();
+	return FTetherShape_AxisAlignedBoundingBox(HullBounds.Min, HullBounds.Max, IsWorldSpace(), AppliedWorldTransform);
+}
+
+void FTetherShape_ConvexHull::BuildHull()
+{
+	Hull = FTetherConvexHullData::Build(Points);
+	SupportVertex = 0;
+}
+
+void FTetherShape_ConvexHull::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		BuildHull();
+		Bounds = ComputeBounds();
+	}
+}
+
+FVector FTetherShape_ConvexHull::GetSupportPoint(const FVector& Direction) const
+{
+	if (!Hull.IsValid())
+	{
+		return Center;
+	}
+
+	// The direction in the hull's frame, scaled so the climb accounts for non-uniform scale
+	const FVector LocalDirection = Rotation.UnrotateVector(Direction) * Scale;
+	SupportVertex = Hull->FindSupportVertex(LocalDirection, SupportVertex);
+	return TransformHullPoint(Hull->Vertices[SupportVertex]);
+}
+
+FVector UTetherShapeObject_ConvexHull::GetLocalSpaceShapeCenter(const FTetherShape& Shape) const
+{
+	const auto* ConvexHull = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+	return Shape.IsWorldSpace() ? ConvexHull->LocalSpace.Center : ConvexHull->Center;
+}
+
+void UTetherShapeObject_ConvexHull::TransformToWorldSpace(FTetherShape& Shape, const FTransform& WorldTransform) const
+{
+	auto* ConvexHull = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+
+	if (Shape.IsWorldSpace())
+	{
+		// Already in world space
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
+		{
+			// No changes required
+			return;
+		}
+	}
+	else
+	{
+		// Cache local space data
+		ConvexHull->CaptureLocalSpace();
+	}
+
+	// Points added after construction, e.g. in the editor, haven't been built into a hull yet
+	if (!ConvexHull->GetHull() && ConvexHull->Points.Num() > 0)
+	{
+		ConvexHull->BuildHull();
+	}
+
+	// Compute the world space data directly from the local space data, the points themselves never change
+	const FTetherConvexHullLocalSpace& Local = ConvexHull->LocalSpace;
+	ConvexHull->Center = WorldTransform.TransformPosition(Local.Center);
+	ConvexHull->Rotation = (WorldTransform.GetRotation() * Local.Rotation.Quaternion()).Rotator();
+	ConvexHull->Scale = WorldTransform.GetScale3D() * Local.Scale;
+}
+
+void UTetherShapeObject_ConvexHull::TransformToLocalSpace(FTetherShape& Shape) const
+{
+	if (!Shape.IsWorldSpace())
+	{
+		// Already there
+		return;
+	}
+
+	auto* CastShape = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+	CastShape->ToLocalSpace_Implementation();
+}
+
+FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_ConvexHull::GetBoundingBox(const FTetherShape& Shape) const
+{
+	const auto* ConvexHull = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+	return ConvexHull->GetBoundingBox();
+}
+
+FTetherShapeBounds UTetherShapeObject_ConvexHull::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* ConvexHull = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+	return ConvexHull->ComputeBounds();
+}
+
+FVector UTetherShapeObject_ConvexHull::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const auto* ConvexHull = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+	return ConvexHull->GetSupportPoint(Direction);
+}
+
+void UTetherShapeObject_ConvexHull::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy,
+	const UWorld* World, const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
+{
+#if ENABLE_DRAW_DEBUG
+	const auto* ConvexHull = FTetherShapeCaster::CastChecked<FTetherShape_ConvexHull>(&Shape);
+	const FTetherConvexHullData* Hull = ConvexHull->GetHull();
+	if (!Hull)
+	{
+		return;
+	}
+
+	// Draw each edge once
+	for (int32 Vertex = 0; Vertex < Hull->Num(); Vertex++)
+	{
+		const FVector Start = ConvexHull->TransformHullPoint(Hull->Vertices[Vertex]);
+		for (const int32 Neighbor : Hull->GetNeighbors(Vertex))
+		{
+			if (Neighbor > Vertex)
+			{
+				UTetherDrawing::DrawLine(World, Proxy, Start, ConvexHull->TransformHullPoint(Hull->Vertices[Neighbor]),
+					Color, bPersistentLines, LifeTime, Thickness);
+			}
+		}
+	}
+#endif
+}
@@ -13,12 +13,19 @@ FTetherShape_OrientedBoundingBox::FTetherShape_OrientedBoundingBox(const FVector
 	, Rotation(InRotation)
 {
 	TetherShapeClass = UTetherShapeObject_OrientedBoundingBox::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
 
 	// Caching initial local space data is required for duplication
-	if (!IsWorldSpace())
-	{
-		LocalSpaceData = MakeShared<FTetherShape_OrientedBoundingBox>(*this);
-	}
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
+}
+
+void FTetherShape_OrientedBoundingBox::CaptureLocalSpace()
+{
+	LocalSpace.Center = Center;
+	LocalSpace.Extent = Extent;
+	LocalSpace.Rotation = Rotation;
 }
 
 void FTetherShape_OrientedBoundingBox::ToLocalSpace_Implementation()
@@ -27,43 +34,36 @@ void FTetherShape_OrientedBoundingBox::ToLocalSpace_Implementation()
 	{
 		return;
 	}
-	
-	if (ensure(LocalSpaceData.IsValid()))
-	{
-		*this = *StaticCastSharedPtr<FTetherShape_OrientedBoundingBox>(LocalSpaceData);
-	}
+
+	Center = LocalSpace.Center;
+	Extent = LocalSpace.Extent;
+	Rotation = LocalSpace.Rotation;
 }
 
-FTetherShape_AxisAlignedBoundingBox FTetherShape_OrientedBoundingBox::GetBoundingBox() const
+FTetherShapeBounds FTetherShape_OrientedBoundingBox::ComputeBounds() const
 {
-	TArray<FVector> Vertices = GetVertices();
-
-	FVector Min = Vertices[0];
-	FVector Max = Vertices[0];
-
-	for (const FVector& Vertex : Vertices)
-	{
-		Min.X = FMath::Min(Min.X, Vertex.X);
-		Min.Y = FMath::Min(Min.Y, Vertex.Y);
-		Min.Z = FMath::Min(Min.Z, Vertex.Z);
-
-		Max.X = FMath::Max(Max.X, Vertex.X);
-		Max.Y = FMath::Max(Max.Y, Vertex.Y);
-		Max.Z = FMath::Max(Max.Z, Vertex.Z);
-	}
+	// Project the rotated extents onto each world axis instead of gathering all eight vertices
+	const FQuat Quat = Rotation.Quaternion();
+	const FVector XAxis = (Quat.GetAxisX() * Extent.X).GetAbs();
+	const FVector YAxis = (Quat.GetAxisY() * Extent.Y).GetAbs();
+	const FVector ZAxis = (Quat.GetAxisZ() * Extent.Z).GetAbs();
+	const FVector WorldExtent = XAxis + YAxis + ZAxis;
+
+	return { Center - WorldExtent, Center + WorldExtent };
+}
 
-	return FTetherShape_AxisAlignedBoundingBox(Min, Max, IsWorldSpace(), AppliedWorldTransform);
+FTetherShape_AxisAlignedBoundingBox FTetherShape_OrientedBoundingBox::GetBoundingBox() const
+{
+	const FTetherShapeBounds OBBBounds = ComputeBounds();
+	return FTetherShape_AxisAlignedBoundingBox(OBBBounds.Min, OBBBounds.Max, IsWorldSpace(), AppliedWorldTransform);
 }
 
 FVector UTetherShapeObject_OrientedBoundingBox::GetLocalSpaceShapeCenter(const FTetherShape& Shape) const
 {
 	if (Shape.IsWorldSpace())
 	{
-		if (ensureAlways(Shape.LocalSpaceData.IsValid()))
-		{
-			const auto* LocalOBB = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(Shape.LocalSpaceData.Get());
-			return LocalOBB->Center;
-		}
+		const auto* OBB = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(&Shape);
+		return OBB->LocalSpace.Center;
 	}
 	else
 	{
@@ -80,32 +80,29 @@ void UTetherShapeObject_OrientedBoundingBox::TransformToWorldSpace(FTetherShape&
 	if (Shape.IsWorldSpace())
 	{
 		// Already in world space
-		if (!Shape.GetAppliedWorldTransform().Equals(WorldTransform))
-		{
-			// Transform has changed, revert to world first
-			TransformToLocalSpace(Shape);
-		}
-		else
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
 		{
 			// No changes required
 			return;
 		}
 	}
-
-	if (!Shape.IsWorldSpace())
+	else
 	{
 		// Cache local space data
-		Shape.LocalSpaceData = Shape.Clone();
+		OBB->CaptureLocalSpace();
 	}
 
+	// Compute the world space data directly from the local space data
+	const FTetherOBBLocalSpace& Local = OBB->LocalSpace;
+
 	// Transform the center to world space
-	FVector TransformedCenter = WorldTransform.TransformPosition(OBB->Center);
+	FVector TransformedCenter = WorldTransform.TransformPosition(Local.Center);
 
 	// Transform the extent based on the scale of the world transform
-	FVector TransformedExtent = WorldTransform.GetScale3D() * OBB->Extent;
+	FVector TransformedExtent = WorldTransform.GetScale3D() * Local.Extent;
 
 	// Apply the rotation
-	FQuat TransformedRotation = WorldTransform.GetRotation() * OBB->Rotation.Quaternion();
+	FQuat TransformedRotation = WorldTransform.GetRotation() * Local.Rotation.Quaternion();
 
 	// Update the OBB with the transformed values
 	OBB->Center = TransformedCenter;
@@ -131,6 +128,27 @@ FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_OrientedBoundingBox::GetB
 	return OBB->GetBoundingBox();
 }
 
+FTetherShapeBounds UTetherShapeObject_OrientedBoundingBox::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* OBB = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(&Shape);
+	return OBB->ComputeBounds();
+}
+
+FVector UTetherShapeObject_OrientedBoundingBox::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const auto* OBB = FTetherShapeCaster::CastChecked<FTetherShape_OrientedBoundingBox>(&Shape);
+
+	// Pick the corner on the direction's side of each local axis
+	const FQuat Quat = OBB->Rotation.Quaternion();
+	const FVector XAxis = Quat.GetAxisX();
+	const FVector YAxis = Quat.GetAxisY();
+	const FVector ZAxis = Quat.GetAxisZ();
+	return OBB->Center +
+		XAxis * ((XAxis | Direction) >= 0.f ? OBB->Extent.X : -OBB->Extent.X) +
+		YAxis * ((YAxis | Direction) >= 0.f ? OBB->Extent.Y : -OBB->Extent.Y) +
+		ZAxis * ((ZAxis | Direction) >= 0.f ? OBB->Extent.Z : -OBB->Extent.Z);
+}
+
 void UTetherShapeObject_OrientedBoundingBox::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy,
 	const UWorld* World, const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
 {
@@ -7,6 +7,191 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TetherShape_Pipe)
 
+FTetherPipeGeometry::FTetherPipeGeometry(const FTetherShape_Pipe& Pipe)
+	: Center(Pipe.Center)
+	, InnerRadius(FMath::Min(Pipe.InnerRadius, Pipe.OuterRadius))
+	, OuterRadius(Pipe.OuterRadius)
+	, HalfThickness(Pipe.Thickness * 0.5f)
+	, ArcRadians(FMath::DegreesToRadians(FMath::Clamp(Pipe.ArcAngle, 0.f, 360.f)))
+{
+	// Matches UTetherDrawing::DrawPipe
+	const FQuat Quat = Pipe.Rotation.Quaternion();
+	Forward = Quat.GetForwardVector();
+	Right = Quat.GetRightVector();
+	Up = Quat.GetUpVector();
+
+	float Sin, Cos;
+	FMath::SinCos(&Sin, &Cos, ArcRadians);
+	EndDirection = { Cos, Sin };
+}
+
+FVector FTetherPipeGeometry::GetClosestPoint(const FVector& Point, bool& bOutInside) const
+{
+	const FVector Local = ToLocal(Point);
+	const FVector2D Planar { Local.X, Local.Y };
+	const float Distance = Planar.Size();
+
+	// Radial direction of the point, or the nearest end of the arc if the point is outside it
+	FVector2D Direction = Distance > KINDA_SMALL_NUMBER ? Planar / Distance : FVector2D(1.f, 0.f);
+	float Radial = Distance;
+	bool bWithinArc = true;
+	if (!IsFullCircle())
+	{
+		const float Angle = GetAngle(Local);
+		if (Angle > ArcRadians)
+		{
+			bWithinArc = false;
+			Direction = (Angle - ArcRadians) < (UE_TWO_PI - Angle) ? EndDirection : FVector2D(1.f, 0.f);
+			Radial = Planar | Direction;
+		}
+	}
+
+	const float ClampedRadial = FMath::Clamp(Radial, InnerRadius, OuterRadius);
+	const float ClampedHeight = FMath::Clamp(Local.Z, -HalfThickness, HalfThickness);
+
+	bOutInside = bWithinArc && ClampedRadial == Radial && ClampedHeight == Local.Z;
+	if (bOutInside)
+	{
+		return Point;
+	}
+	return ToWorld(FVector(Direction * ClampedRadial, ClampedHeight));
+}
+
+float FTetherPipeGeometry::GetPenetration(const FVector& Point, FVector& OutNormal) const
+{
+	const FVector Local = ToLocal(Point);
+	const FVector2D Planar { Local.X, Local.Y };
+	const float Distance = Planar.Size();
+	const FVector2D Direction = Distance > KINDA_SMALL_NUMBER ? Planar / Distance : FVector2D(1.f, 0.f);
+
+	// Find the nearest face, starting with the top and bottom
+	float Depth = HalfThickness - FMath::Abs(Local.Z);
+	FVector LocalNormal { 0.f, 0.f, Local.Z >= 0.f ? 1.f : -1.f };
+
+	const auto TestFace = [&Depth, &LocalNormal](float FaceDepth, const FVector& FaceNormal)
+	{
+		if (FaceDepth < Depth)
+		{
+			Depth = FaceDepth;
+			LocalNormal = FaceNormal;
+		}
+	};
+
+	TestFace(OuterRadius - Distance, FVector(Direction, 0.f));
+	if (InnerRadius > 0.f)
+	{
+		TestFace(Distance - InnerRadius, FVector(-Direction, 0.f));
+	}
+
+	if (!IsFullCircle())
+	{
+		// Distance to the planes of the start and end caps, their normals point away from the arc
+		const float Angle = GetAngle(Local);
+		TestFace(Angle < UE_HALF_PI ? Distance * FMath::Sin(Angle) : Distance, FVector(0.f, -1.f, 0.f));
+
+		const float ToEnd = ArcRadians - Angle;
+		TestFace(ToEnd < UE_HALF_PI ? Distance * FMath::Sin(ToEnd) : Distance, FVector(-EndDirection.Y, EndDirection.X, 0.f));
+	}
+
+	OutNormal = Forward * LocalNormal.X + Right * LocalNormal.Y + Up * LocalNormal.Z;
+	return FMath::Max(0.f, Depth);
+}
+
+FVector FTetherPipeGeometry::GetSupportPoint(const FVector& Direction) const
+{
+	const FVector Local { Direction | Forward, Direction | Right, Direction | Up };
+	const FVector2D Planar { Local.X, Local.Y };
+	const float Height = Local.Z >= 0.f ? HalfThickness : -HalfThickness;
+
+	// The outer wall facing the direction, if it lies within the arc
+	const float Distance = Planar.Size();
+	if (Distance <= KINDA_SMALL_NUMBER)
+	{
+		return ToWorld(FVector(OuterRadius, 0.f, Height));
+	}
+	if (IsFullCircle() || GetAngle(Local) <= ArcRadians)
+	{
+		return ToWorld(FVector(Planar / Distance * OuterRadius, Height));
+	}
+
+	// Otherwise the best of the corners at either end of the arc
+	const FVector2D Corners[4] =
+	{
+		FVector2D(OuterRadius, 0.f), FVector2D(InnerRadius, 0.f), EndDirection * OuterRadius, EndDirection * InnerRadius
+	};
+	FVector2D Best = Corners[0];
+	for (const FVector2D& Corner : Corners)
+	{
+		if ((Corner | Planar) > (Best | Planar))
+		{
+			Best = Corner;
+		}
+	}
+	return ToWorld(FVector(Best, Height));
+}
+
+FVector FTetherPipeGeometry::GetRadialDirection(float Angle) const
+{
+	const FVector2D Direction = GetArcDirection(Angle);
+	return Forward * Direction.X + Right * Direction.Y;
+}
+
+FVector FTetherPipeGeometry::GetTangentDirection(float Angle) const
+{
+	const FVector2D Direction = GetArcDirection(Angle);
+	return Right * Direction.X - Forward * Direction.Y;
+}
+
+FVector FTetherPipeGeometry::GetClosestPointOnSection(const FVector& Point, float Angle, float& OutRadial) const
+{
+	// The cross-section is a rectangle in the half-plane at this angle, clamp within it
+	const FVector Local = ToLocal(Point);
+	const FVector2D Direction = GetArcDirection(Angle);
+	OutRadial = FMath::Clamp(FVector2D(Local.X, Local.Y) | Direction, InnerRadius, OuterRadius);
+	return ToWorld(FVector(Direction * OutRadial, FMath::Clamp(Local.Z, -HalfThickness, HalfThickness)));
+}
+
+void FTetherPipeGeometry::GetSegmentDirections(int32 Segment, FVector2D& OutStart, FVector2D& OutEnd) const
+{
+	const float SegmentRadians = ArcRadians / GetNumSegments();
+	OutStart = GetArcDirection(SegmentRadians * Segment);
+	OutEnd = GetArcDirection(SegmentRadians * (Segment + 1));
+}
+
+FVector FTetherPipeGeometry::GetSegmentSupportPoint(const FVector2D& Start, const FVector2D& End,
+	const FVector& Direction) const
+{
+	const FVector Local { Direction | Forward, Direction | Right, Direction | Up };
+	const FVector2D Planar { Local.X, Local.Y };
+	const float Height = Local.Z >= 0.f ? HalfThickness : -HalfThickness;
+
+	// The outer wall facing the direction, if it lies between the ends, segments span less than PI so the cross
+	// products are enough to tell
+	const float Distance = Planar.Size();
+	if (Distance > KINDA_SMALL_NUMBER && (Start ^ Planar) >= 0.f && (Planar ^ End) >= 0.f)
+	{
+		return ToWorld(FVector(Planar / Distance * OuterRadius, Height));
+	}
+
+	// Otherwise the best of the corners at either end, the inner wall is the chord between them
+	const FVector2D Corners[4] = { Start * OuterRadius, Start * InnerRadius, End * OuterRadius, End * InnerRadius };
+	FVector2D Best = Corners[0];
+	for (const FVector2D& Corner : Corners)
+	{
+		if ((Corner | Planar) > (Best | Planar))
+		{
+			Best = Corner;
+		}
+	}
+	return ToWorld(FVector(Best, Height));
+}
+
+bool FTetherShape_Pipe::IsPipe(const FTetherShape& Shape)
+{
+	static const uint8 PipeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
+	return Shape.GetShapeTypeId() == PipeId;
+}
+
 FTetherShape_Pipe::FTetherShape_Pipe(const FVector& InCenter, float InOuterRadius, float InInnerRadius,
 	float InThickness, float InArcAngle, const FRotator& InRotation)
 	: Center(InCenter)
@@ -17,12 +202,21 @@ FTetherShape_Pipe::FTetherShape_Pipe(const FVector& InCenter, float InOuterRadiu
 	, ArcAngle(InArcAngle)
 {
 	TetherShapeClass = UTetherShapeObject_Pipe::StaticClass();
+	ShapeTypeId = FTetherShapeTypeRegistry::GetShapeTypeId(StaticShapeType());
 	
 	// Caching initial local space data is required for duplication
-	if (!IsWorldSpace())
-	{
-		LocalSpaceData = MakeShared<FTetherShape_Pipe>(*this);
-	}
+	CaptureLocalSpace();
+
+	Bounds = ComputeBounds();
+}
+
+void FTetherShape_Pipe::CaptureLocalSpace()
+{
+	LocalSpace.Center = Center;
+	LocalSpace.Rotation = Rotation;
+	LocalSpace.OuterRadius = OuterRadius;
+	LocalSpace.InnerRadius = InnerRadius;
+	LocalSpace.Thickness = Thickness;
 }
 
 void FTetherShape_Pipe::ToLocalSpace_Implementation()
@@ -31,14 +225,15 @@ void FTetherShape_Pipe::ToLocalSpace_Implementation()
 	{
 		return;
 	}
-	
-	if (ensure(LocalSpaceData.IsValid()))
-	{
-		*this = *StaticCastSharedPtr<FTetherShape_Pipe>(LocalSpaceData);
-	}
+
+	Center = LocalSpace.Center;
+	Rotation = LocalSpace.Rotation;
+	OuterRadius = LocalSpace.OuterRadius;
+	InnerRadius = LocalSpace.InnerRadius;
+	Thickness = LocalSpace.Thickness;
 }
 
-FTetherShape_AxisAlignedBoundingBox FTetherShape_Pipe::GetBoundingBox() const
+FTetherShapeBounds FTetherShape_Pipe::ComputeBounds() const
 {
 	// Calculate the extents based on the pipe's outer radius and thickness
 	FVector Extents { OuterRadius, OuterRadius, Thickness * 0.5f };
@@ -47,18 +242,21 @@ FTetherShape_AxisAlignedBoundingBox FTetherShape_Pipe::GetBoundingBox() const
 	FVector Min = Center - Extents;
 	FVector Max = Center + Extents;
 
-	return FTetherShape_AxisAlignedBoundingBox(Min, Max, IsWorldSpace(), AppliedWorldTransform);
+	return { Min, Max };
+}
+
+FTetherShape_AxisAlignedBoundingBox FTetherShape_Pipe::GetBoundingBox() const
+{
+	const FTetherShapeBounds PipeBounds = ComputeBounds();
+	return FTetherShape_AxisAlignedBoundingBox(PipeBounds.Min, PipeBounds.Max, IsWorldSpace(), AppliedWorldTransform);
 }
 
 FVector UTetherShapeObject_Pipe::GetLocalSpaceShapeCenter(const FTetherShape& Shape) const
 {
 	if (Shape.IsWorldSpace())
 	{
-		if (ensureAlways(Shape.LocalSpaceData.IsValid()))
-		{
-			const auto* LocalPipe = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(Shape.LocalSpaceData.Get());
-			return LocalPipe->Center;
-		}
+		const auto* Pipe = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(&Shape);
+		return Pipe->LocalSpace.Center;
 	}
 	else
 	{
@@ -75,45 +273,39 @@ void UTetherShapeObject_Pipe::TransformToWorldSpace(FTetherShape& Shape, const F
 	if (Shape.IsWorldSpace())
 	{
 		// Already in world space
-		if (!Shape.GetAppliedWorldTransform().Equals(WorldTransform))
-		{
-			// Transform has changed, revert to world first
-			TransformToLocalSpace(Shape);
-		}
-		else
+		if (Shape.GetAppliedWorldTransform().Equals(WorldTransform))
 		{
 			// No changes required
 			return;
 		}
 	}
-
-	if (!Shape.IsWorldSpace())
+	else
 	{
 		// Cache local space data
-		Shape.LocalSpaceData = Shape.Clone();
+		Pipe->CaptureLocalSpace();
 	}
 
-	// Clone current state prior to conversion
-	Pipe->LocalSpaceData = Pipe->Clone();
+	// Compute the world space data directly from the local space data
+	const FTetherPipeLocalSpace& Local = Pipe->LocalSpace;
 
 	// Transform the center to world space
-	FVector TransformedCenter = WorldTransform.TransformPosition(Pipe->Center);
+	FVector TransformedCenter = WorldTransform.TransformPosition(Local.Center);
 
 	// Apply scaling to the pipe's radii and thickness based on the scale of the world transform
 	FVector Scale = WorldTransform.GetScale3D();
-	float TransformedOuterRadius = Pipe->OuterRadius * Scale.X;  // Assuming uniform scale for the radius
-	float TransformedInnerRadius = Pipe->InnerRadius * Scale.X;  // Same scaling for inner radius
-	float TransformedThickness = Pipe->Thickness * Scale.Z;      // Thickness along Z-axis
+	float TransformedOuterRadius = Local.OuterRadius * Scale.X;  // Assuming uniform scale for the radius
+	float TransformedInnerRadius = Local.InnerRadius * Scale.X;  // Same scaling for inner radius
+	float TransformedThickness = Local.Thickness * Scale.Z;      // Thickness along Z-axis
 
 	// Apply the rotation
-	FRotator TransformedRotation = WorldTransform.GetRotation().Rotator() + Pipe->Rotation;
+	FQuat TransformedRotation = WorldTransform.GetRotation() * Local.Rotation.Quaternion();
 
 	// Update the pipe with the transformed values
 	Pipe->Center = TransformedCenter;
 	Pipe->OuterRadius = TransformedOuterRadius;
 	Pipe->InnerRadius = TransformedInnerRadius;
 	Pipe->Thickness = TransformedThickness;
-	Pipe->Rotation = TransformedRotation;
+	Pipe->Rotation = TransformedRotation.Rotator();
 }
 
 void UTetherShapeObject_Pipe::TransformToLocalSpace(FTetherShape& Shape) const
@@ -134,6 +326,18 @@ FTetherShape_AxisAlignedBoundingBox UTetherShapeObject_Pipe::GetBoundingBox(cons
 	return Pipe->GetBoundingBox();
 }
 
+FTetherShapeBounds UTetherShapeObject_Pipe::ComputeBounds(const FTetherShape& Shape) const
+{
+	const auto* Pipe = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(&Shape);
+	return Pipe->ComputeBounds();
+}
+
+FVector UTetherShapeObject_Pipe::GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const
+{
+	const auto* Pipe = FTetherShapeCaster::CastChecked<FTetherShape_Pipe>(&Shape);
+	return Pipe->GetGeometry().GetSupportPoint(Direction);
+}
+
 void UTetherShapeObject_Pipe::DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 	const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const
 {
@@ -8,6 +8,8 @@ namespace FTetherGameplayTags
 	/** Gameplay tags for tether hashing systems */
 	UE_DEFINE_GAMEPLAY_TAG(Tether_Hashing, "Tether.Hashing");
 	UE_DEFINE_GAMEPLAY_TAG(Tether_Hashing_Spatial, "Tether.Hashing.Spatial");
+	UE_DEFINE_GAMEPLAY_TAG(Tether_Hashing_SweepAndPrune, "Tether.Hashing.SweepAndPrune");
+	UE_DEFINE_GAMEPLAY_TAG(Tether_Hashing_DynamicTree, "Tether.Hashing.DynamicTree");
 
 	/** Gameplay tags for tether detection systems */
 	UE_DEFINE_GAMEPLAY_TAG(Tether_Detection_BroadPhase, "Tether.Detection.BroadPhase");
@@ -19,6 +21,7 @@ namespace FTetherGameplayTags
 	
 	/** Gameplay tags for tether physics solvers */
 	UE_DEFINE_GAMEPLAY_TAG(Tether_Solver_Linear, "Tether.Solver.Linear");
+	UE_DEFINE_GAMEPLAY_TAG(Tether_Solver_Linear_SIMD, "Tether.Solver.Linear.SIMD");
 	UE_DEFINE_GAMEPLAY_TAG(Tether_Solver_Angular, "Tether.Solver.Angular");
 
 	/** Gameplay tags for tether integration solvers */
@@ -60,4 +63,6 @@ namespace FTetherGameplayTags
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Tether_Shape_BoundingSphere, "Tether.Shape.BoundingSphere", "The Bounding Sphere is extremely simple to compute. It is defined by a center point and a radius, which can be derived from the furthest point from the center of the object.");
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Tether_Shape_Capsule, "Tether.Shape.Capsule", "Capsules are more complex than spheres due to their elongated shape, but they are simpler than boxes (OBB) when it comes to collision detection. Collision detection for capsules typically involves checking both the cylindrical part and the hemispherical ends, which is more complex than sphere collision detection but still relatively efficient.");
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Tether_Shape_Pipe, "Tether.Shape.Pipe", "Pipes are more complex than capsules and spheres due to their hollow cylindrical shape with adjustable arc angles, but they are simpler than boxes (OBB) when it comes to collision detection. Collision detection for pipes involves checking both the inner and outer surfaces, as well as accounting for the specified arc, making it more complex than capsule or sphere detection but still relatively efficient.");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Tether_Shape_ConvexHull, "Tether.Shape.ConvexHull", "Convex Hulls wrap an arbitrary set of points, fitting irregular objects far more closely than boxes or capsules so a single hull can replace several stacked primitives. Collision detection uses GJK on the hull's support function, which hill-climbs the hull's edges from the previous result, making it more expensive than the primitive shapes but independent of how many primitives it replaces.");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Tether_Shape_Compound, "Tether.Shape.Compound", "Compounds group several spheres, capsules, boxes and convex hulls into a single body. The broad-phase only sees the compound's bounds, so its children never generate pairs with each other, and the narrow-phase only tests the children whose bounds overlap the other shape, found through a small bounding volume hierarchy.");
 }
\ No newline at end of file
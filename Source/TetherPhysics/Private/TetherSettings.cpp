@@ -8,7 +8,9 @@
 #include "Physics/Collision/TetherCollisionDetectionBroadPhase.h"
 #include "Physics/Collision/TetherCollisionDetectionHandler.h"
 #include "Physics/Collision/TetherCollisionDetectionNarrowPhase.h"
+#include "Physics/Hashing/TetherHashingDynamicTree.h"
 #include "Physics/Hashing/TetherHashingSpatial.h"
+#include "Physics/Hashing/TetherHashingSweepAndPrune.h"
 #include "Physics/Replay/TetherReplay.h"
 #include "Physics/Solvers/Contact/TetherContactSolverImpulseVelocityLevel.h"
 #include "Physics/Solvers/Contact/TetherContactSolverIterative.h"
@@ -18,6 +20,7 @@
 #include "Physics/Solvers/Integration/TetherIntegrationSolverRK4.h"
 #include "Physics/Solvers/Integration/TetherIntegrationSolverVerlet.h"
 #include "Physics/Solvers/Physics/TetherPhysicsSolverLinear.h"
+#include "Physics/Solvers/Physics/TetherPhysicsSolverLinearSIMD.h"
 #include "Physics/Solvers/Physics/TetherPhysicsSolverAngular.h"
 #include "Shapes/TetherShape_AxisAlignedBoundingBox.h"
 
@@ -28,6 +31,8 @@ UTetherSettings::UTetherSettings(const FObjectInitializer& ObjectInitializer)
 {
 	// Default Hashing (Spatial)
 	HashingSystems.Add({ FTetherGameplayTags::Tether_Hashing_Spatial.GetTag(), UTetherHashingSpatial::StaticClass() });
+	HashingSystems.Add({ FTetherGameplayTags::Tether_Hashing_SweepAndPrune.GetTag(), UTetherHashingSweepAndPrune::StaticClass() });
+	HashingSystems.Add({ FTetherGameplayTags::Tether_Hashing_DynamicTree.GetTag(), UTetherHashingDynamicTree::StaticClass() });
 
 	// Default Collision and Detection
 	BroadPhaseDetectionSystems.Add({ FTetherGameplayTags::Tether_Detection_BroadPhase.GetTag(), UTetherCollisionDetectionBroadPhase::StaticClass() });
@@ -39,6 +44,7 @@ UTetherSettings::UTetherSettings(const FObjectInitializer& ObjectInitializer)
 	
 	// Default Physics Solvers
 	LinearPhysicsSolvers.Add({ FTetherGameplayTags::Tether_Solver_Linear.GetTag(), UTetherPhysicsSolverLinear::StaticClass() });
+	LinearPhysicsSolvers.Add({ FTetherGameplayTags::Tether_Solver_Linear_SIMD.GetTag(), UTetherPhysicsSolverLinearSIMD::StaticClass() });
 	AngularPhysicsSolvers.Add({ FTetherGameplayTags::Tether_Solver_Angular.GetTag(), UTetherPhysicsSolverAngular::StaticClass() });
 	
 	// Default Integration Solvers
@@ -0,0 +1,119 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Structure-of-arrays batches for the narrow phase.
+ *
+ * Pairs are bucketed by shape type and packed into float lanes so that each kernel tests four pairs per
+ * vector instruction. Positions are stored relative to ShapeA's center (kept in double precision in Origins),
+ * so the float lanes don't lose precision far from the world origin.
+ *
+ * Kernels report a hit mask, the contact point relative to the origin, and the penetration depth.
+ * The contact normal is left to the caller.
+ */
+struct TETHERPHYSICS_API FTetherNarrowPhaseBatch
+{
+	virtual ~FTetherNarrowPhaseBatch() = default;
+
+	/** Index into the narrow phase's CollisionPairings for each packed pair */
+	TArray<int32> PairIndices;
+
+	/** World space center of ShapeA, all packed positions are relative to this */
+	TArray<FVector> Origins;
+
+	/** Results, one bit per pair in groups of four */
+	TArray<int32> HitMasks;
+	TArray<float> ContactX;
+	TArray<float> ContactY;
+	TArray<float> ContactZ;
+	TArray<float> PenetrationDepth;
+
+	int32 Num() const { return PairIndices.Num(); }
+
+	bool IsHit(int32 Index) const { return (HitMasks[Index >> 2] >> (Index & 3)) & 1; }
+
+	FVector GetContactPoint(int32 Index) const
+	{
+		return Origins[Index] + FVector(ContactX[Index], ContactY[Index], ContactZ[Index]);
+	}
+
+	virtual void Reset();
+
+	/** Run the kernel over every packed pair */
+	virtual void Solve() = 0;
+
+protected:
+	/** Pads the lanes to a multiple of four and sizes the result arrays, returns the padded count */
+	int32 PrepareResults(const TArrayView<TArray<float>*>& Lanes);
+};
+
+/** BoundingSphere vs BoundingSphere */
+struct TETHERPHYSICS_API FTetherSphereSphereBatch final : public FTetherNarrowPhaseBatch
+{
+	TArray<float> BX, BY, BZ;
+	TArray<float> RadiusSum;
+
+	void Add(int32 PairIndex, const FVector& CenterA, float RadiusA, const FVector& CenterB, float RadiusB);
+
+	virtual void Reset() override;
+	virtual void Solve() override;
+};
+
+/** BoundingSphere vs Capsule, the sphere is always the origin regardless of pair order */
+struct TETHERPHYSICS_API FTetherSphereCapsuleBatch final : public FTetherNarrowPhaseBatch
+{
+	/** Capsule segment start, and the segment vector from start to end */
+	TArray<float> PX, PY, PZ;
+	TArray<float> DX, DY, DZ;
+	TArray<float> RadiusSum;
+
+	void Add(int32 PairIndex, const FVector& SphereCenter, float SphereRadius, const FVector& CapsuleStart,
+		const FVector& CapsuleEnd, float CapsuleRadius);
+
+	virtual void Reset() override;
+	virtual void Solve() override;
+};
+
+/** Capsule vs Capsule */
+struct TETHERPHYSICS_API FTetherCapsuleCapsuleBatch final : public FTetherNarrowPhaseBatch
+{
+	/** Capsule A segment start and segment vector */
+	TArray<float> APX, APY, APZ;
+	TArray<float> ADX, ADY, ADZ;
+
+	/** Capsule B segment start and segment vector */
+	TArray<float> BPX, BPY, BPZ;
+	TArray<float> BDX, BDY, BDZ;
+
+	TArray<float> RadiusSum;
+
+	void Add(int32 PairIndex, const FVector& CenterA, const FVector& StartA, const FVector& EndA, float RadiusA,
+		const FVector& StartB, const FVector& EndB, float RadiusB);
+
+	virtual void Reset() override;
+	virtual void Solve() override;
+};
+
+/**
+ * Per-tick scratch for the batched narrow phase, held by FNarrowPhaseOutput so allocations persist between ticks
+ */
+struct TETHERPHYSICS_API FTetherNarrowPhaseBatches
+{
+	FTetherSphereSphereBatch SphereSphere;
+	FTetherSphereCapsuleBatch SphereCapsule;
+	FTetherCapsuleCapsuleBatch CapsuleCapsule;
+
+	/** Pairs without a batched kernel, keyed by (TypeA, TypeB) in the high bits and pair index in the low bits */
+	TArray<uint64> ScalarPairs;
+
+	void Reset()
+	{
+		SphereSphere.Reset();
+		SphereCapsule.Reset();
+		CapsuleCapsule.Reset();
+		ScalarPairs.Reset();
+	}
+};
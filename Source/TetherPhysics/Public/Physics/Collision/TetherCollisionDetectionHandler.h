@@ -14,6 +14,39 @@ struct FTetherShape_OrientedBoundingBox;
 struct FTetherShape_BoundingSphere;
 struct FNarrowPhaseCollision;
 struct FTetherShape_AxisAlignedBoundingBox;
+struct FTetherGJKSimplex;
+
+/**
+ * 2D function pointer tables indexed by (ShapeTypeIdA, ShapeTypeIdB)
+ * 
+ * Each entry either points at a routine that expects the shapes in (A, B) order, or is flagged as swapped,
+ * in which case the routine expects (B, A) and the narrow phase contact normal is flipped afterwards
+ */
+struct TETHERPHYSICS_API FTetherCollisionDispatchTable
+{
+	using FBroadFunc = bool(*)(const FTetherShape* ShapeA, const FTetherShape* ShapeB);
+	using FNarrowFunc = bool(*)(const FTetherShape* ShapeA, const FTetherShape* ShapeB, FNarrowPhaseCollision& Output);
+
+	struct FBroadEntry
+	{
+		FBroadFunc Func = nullptr;
+		bool bSwap = false;
+	};
+
+	struct FNarrowEntry
+	{
+		FNarrowFunc Func = nullptr;
+		bool bSwap = false;
+	};
+
+	static constexpr uint8 MaxShapeTypes = FTetherShapeTypeRegistry::MaxShapeTypes;
+
+	FBroadEntry Broad[MaxShapeTypes][MaxShapeTypes];
+	FNarrowEntry Narrow[MaxShapeTypes][MaxShapeTypes];
+
+	void AddBroad(const FGameplayTag& TypeA, const FGameplayTag& TypeB, FBroadFunc Func, bool bSymmetric);
+	void AddNarrow(const FGameplayTag& TypeA, const FGameplayTag& TypeB, FNarrowFunc Func, bool bSymmetric);
+};
 
 /**
  * This class handles collision interactions between different shapes.
@@ -23,11 +56,17 @@ struct FTetherShape_AxisAlignedBoundingBox;
  * asymmetric (order might matter), because the order can influence the complexity of
  * the calculations.
  * 
- * If you want to add custom shapes, then you will need to subclass this and override
- * CheckBroadCollision() and CheckNarrowCollision() to handle the collision of your shapes.
+ * Dispatch is table-driven, each shape resolves its type to a compact ID once and the pair of IDs
+ * indexes straight into FTetherCollisionDispatchTable.
  *
- * Your new class will need to be assigned to UTetherDeveloperSettings::ShapeCollisionControl,
- * via Project Settings.
+ * Broad pairs without a registered routine fall back to a bounds overlap, and narrow pairs to
+ * CheckNarrowCollisionConvex(), which uses GJK and EPA on the shapes' support functions, so a custom shape only
+ * needs UTetherShapeObject::GetSupportPoint() to collide.
+ *
+ * If you want to add custom shapes, register your pair functions via RegisterBroadCollision() and
+ * RegisterNarrowCollision() during module startup. Alternatively subclass this and override
+ * CheckBroadCollision() and CheckNarrowCollision(), your new class will need to be assigned to
+ * UTetherDeveloperSettings::ShapeCollisionControl, via Project Settings.
  */
 UCLASS(Const, NotBlueprintType, NotBlueprintable)
 class TETHERPHYSICS_API UTetherCollisionDetectionHandler : public UObject
@@ -43,6 +82,84 @@ public:
 	/** Narrow Collision is a complex collision that occurs after the physics simulation */
 	virtual bool CheckNarrowCollision(const FTetherShape* ShapeA, const FTetherShape* ShapeB, FNarrowPhaseCollision& Output) const;
 
+	/**
+	 * Generic narrow collision for any pair of convex shapes, see FTetherGJK
+	 * Pipes are concave, they are split into convex segments by Narrow_Pipe_Convex()
+	 * @param Simplex Optional simplex from the pair cache, to warm start from last tick's result
+	 */
+	virtual bool CheckNarrowCollisionConvex(const FTetherShape* ShapeA, const FTetherShape* ShapeB,
+		FNarrowPhaseCollision& Output, FTetherGJKSimplex* Simplex = nullptr) const;
+
+	/**
+	 * Narrow collision where either shape is a FTetherShape_Compound, tests each child overlapping the other shape
+	 * and keeps the deepest contact. Output keeps the compound, not the child, as its shape
+	 */
+	virtual bool CheckNarrowCollisionCompound(const FTetherShape* ShapeA, const FTetherShape* ShapeB,
+		FNarrowPhaseCollision& Output) const;
+
+	/** True if a dedicated narrow routine is registered for the pair of shape types */
+	static bool HasNarrowCollision(uint8 TypeA, uint8 TypeB);
+
+	/** Dispatch tables shared by all handlers, built-in shape pairs are registered on first access */
+	static FTetherCollisionDispatchTable& GetDispatchTable();
+
+	/**
+	 * Register a broad phase routine for the shape type pair
+	 * @param bSymmetric Also fill (TypeB, TypeA) with a swapped entry, unless it is already registered
+	 * @note Not thread-safe, register during module startup before any simulation runs
+	 */
+	static void RegisterBroadCollision(const FGameplayTag& TypeA, const FGameplayTag& TypeB,
+		FTetherCollisionDispatchTable::FBroadFunc Func, bool bSymmetric = true);
+
+	/**
+	 * Register a narrow phase routine for the shape type pair
+	 * @param bSymmetric Also fill (TypeB, TypeA) with a swapped entry, unless it is already registered
+	 * @note Not thread-safe, register during module startup before any simulation runs
+	 */
+	static void RegisterNarrowCollision(const FGameplayTag& TypeA, const FGameplayTag& TypeB,
+		FTetherCollisionDispatchTable::FNarrowFunc Func, bool bSymmetric = true);
+
+	/** Register a typed broad phase routine, e.g. RegisterBroadCollision<FMyShape, FTetherShape_Capsule, &Broad_MyShape_Capsule>() */
+	template<typename TA, typename TB, bool(*Func)(const TA*, const TB*)>
+	static void RegisterBroadCollision(bool bSymmetric = true)
+	{
+		RegisterBroadCollision(TA::StaticShapeType(), TB::StaticShapeType(), &BroadThunk<TA, TB, Func>, bSymmetric);
+	}
+
+	/** Register a typed narrow phase routine, e.g. RegisterNarrowCollision<FMyShape, FTetherShape_Capsule, &Narrow_MyShape_Capsule>() */
+	template<typename TA, typename TB, bool(*Func)(const TA*, const TB*, FNarrowPhaseCollision&)>
+	static void RegisterNarrowCollision(bool bSymmetric = true)
+	{
+		RegisterNarrowCollision(TA::StaticShapeType(), TB::StaticShapeType(), &NarrowThunk<TA, TB, Func>, bSymmetric);
+	}
+
+protected:
+	/** Casts to the concrete shape types before calling the typed routine */
+	template<typename TA, typename TB, bool(*Func)(const TA*, const TB*)>
+	static bool BroadThunk(const FTetherShape* ShapeA, const FTetherShape* ShapeB)
+	{
+		return Func(static_cast<const TA*>(ShapeA), static_cast<const TB*>(ShapeB));
+	}
+
+	template<typename TA, typename TB, bool(*Func)(const TA*, const TB*, FNarrowPhaseCollision&)>
+	static bool NarrowThunk(const FTetherShape* ShapeA, const FTetherShape* ShapeB, FNarrowPhaseCollision& Output)
+	{
+		return Func(static_cast<const TA*>(ShapeA), static_cast<const TB*>(ShapeB), Output);
+	}
+
+	static void RegisterDefaultCollisions(FTetherCollisionDispatchTable& Table);
+
+	static bool Narrow_Convex(const FTetherShape* A, const FTetherShape* B, FNarrowPhaseCollision& Output,
+		FTetherGJKSimplex* Simplex = nullptr);
+
+	/**
+	 * Pipe vs any convex shape, using GJK and EPA against each convex segment of the pipe that B's bounds overlap
+	 * and keeping the deepest contact, see FTetherPipeGeometry::GetSegmentSupportPoint()
+	 */
+	static bool Narrow_Pipe_Convex(const FTetherShape_Pipe* A, const FTetherShape* B, FNarrowPhaseCollision& Output);
+
+public:
+
 	// Broad-phase collision checks
 	static bool Broad_AABB_AABB(const FTetherShape_AxisAlignedBoundingBox* A, const FTetherShape_AxisAlignedBoundingBox* B);
 	static bool Broad_AABB_BoundingSphere(const FTetherShape_AxisAlignedBoundingBox* A, const FTetherShape_BoundingSphere* B);
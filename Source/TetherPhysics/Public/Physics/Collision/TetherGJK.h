@@ -0,0 +1,116 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FTetherShape;
+class UTetherShapeObject;
+
+/** Furthest point of a convex set in the given world space direction */
+using FTetherGJKSupportFunc = TFunctionRef<FVector(const FVector&)>;
+
+/** A vertex of the Minkowski difference A - B, and the support points on each shape that produced it */
+struct FTetherGJKVertex
+{
+	FVector Point = FVector::ZeroVector;
+	FVector SupportA = FVector::ZeroVector;
+	FVector SupportB = FVector::ZeroVector;
+
+	/** Search direction that produced the vertex, kept for warm starting */
+	FVector Direction = FVector::ZeroVector;
+};
+
+/**
+ * Simplex carried forward between ticks for a pair of shapes, stored on the pair cache entry
+ *
+ * Only the search directions are kept, the support points are re-evaluated against the shapes' current transforms,
+ * so frame-coherent pairs start from last tick's answer and typically converge in one or two iterations.
+ */
+struct TETHERPHYSICS_API FTetherGJKSimplex
+{
+	FVector Directions[4];
+	int32 NumDirections = 0;
+
+	/** The shape the directions were computed with as A, they are flipped if the pair is tested the other way round */
+	const FTetherShape* ShapeA = nullptr;
+
+	/** GJK iterations taken by the last query, for comparing warm and cold starts */
+	int32 LastIterations = 0;
+
+	void Reset()
+	{
+		NumDirections = 0;
+		ShapeA = nullptr;
+	}
+};
+
+struct FTetherGJKResult
+{
+	/** True if the shapes overlap, PenetrationDepth and Normal are only valid if EPA ran */
+	bool bOverlap = false;
+
+	/** Distance between the shapes when they don't overlap */
+	float Distance = 0.f;
+
+	/** Penetration depth when the shapes overlap */
+	float PenetrationDepth = 0.f;
+
+	/** Closest points when separated, or the deepest points when overlapping */
+	FVector PointA = FVector::ZeroVector;
+	FVector PointB = FVector::ZeroVector;
+
+	/** Direction from A to B: the separating direction, or the direction to push B out of A */
+	FVector Normal = FVector::ZeroVector;
+
+	int32 Iterations = 0;
+};
+
+/**
+ * Generic convex collision using each shape's support function (UTetherShapeObject::GetSupportPoint)
+ *
+ * GJK finds the distance between the shapes, or that they overlap, and EPA expands the final simplex to find the
+ * penetration depth. Any shape type with a support function collides with any other without a dedicated routine,
+ * concave shapes such as partial pipes are treated as their convex hull.
+ */
+struct TETHERPHYSICS_API FTetherGJK
+{
+	/**
+	 * @param Simplex             Optional simplex to warm start from, updated with the result
+	 * @param bComputePenetration Run EPA when the shapes overlap
+	 */
+	static FTetherGJKResult Query(const FTetherShape& A, const FTetherShape& B, FTetherGJKSimplex* Simplex = nullptr,
+		bool bComputePenetration = true);
+
+	/**
+	 * Query between two support functions, for convex pieces that aren't shapes themselves, e.g. segments of a pipe
+	 * @param InitialDirection    Direction to start the search from, typically from B's center towards A's
+	 * @param bComputePenetration Run EPA when the shapes overlap
+	 */
+	static FTetherGJKResult Query(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB,
+		const FVector& InitialDirection, bool bComputePenetration = true);
+
+protected:
+	static FTetherGJKVertex Support(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB,
+		const FVector& Direction);
+
+	/**
+	 * Iterate GJK from the seeded vertices until it converges, finds an overlap, or runs out of iterations
+	 * Fills in the distance and closest points of the result when the shapes are separated
+	 */
+	static void Iterate(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB, FTetherGJKVertex* Vertices,
+		int32& NumVertices, FTetherGJKResult& Result);
+
+	/**
+	 * Closest point on the simplex to the origin, reducing the simplex to the vertices that support it
+	 * @return The closest point, zero with all four vertices kept if the origin is inside the tetrahedron
+	 */
+	static FVector ReduceSimplex(FTetherGJKVertex* Vertices, int32& NumVertices, float* Weights);
+
+	static FVector ReduceTriangle(const FTetherGJKVertex& A, const FTetherGJKVertex& B, const FTetherGJKVertex& C,
+		FTetherGJKVertex* OutVertices, int32& OutNumVertices, float* OutWeights);
+
+	/** Expand the simplex into a tetrahedron surrounding the origin and find the closest face */
+	static void SolveEPA(FTetherGJKSupportFunc SupportA, FTetherGJKSupportFunc SupportB, FTetherGJKVertex* Vertices,
+		int32 NumVertices, FTetherGJKResult& Result);
+};
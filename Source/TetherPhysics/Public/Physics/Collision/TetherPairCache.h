@@ -0,0 +1,174 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Physics/Collision/TetherGJK.h"
+#include "Shapes/TetherShape.h"
+#include "TetherPairCache.generated.h"
+
+struct FNarrowPhaseCollision;
+
+/**
+ * Lifetime state of an overlap or contact between a pair of shapes
+ */
+UENUM(BlueprintType)
+enum class ETetherContactState : uint8
+{
+	None				UMETA(ToolTip="Not in contact"),
+	Begin				UMETA(ToolTip="Contact began this tick"),
+	Persist				UMETA(ToolTip="Contact began on a previous tick and is ongoing"),
+	End					UMETA(ToolTip="Contact ended this tick"),
+};
+
+/**
+ * Persistent data for a single pair of shapes, carried forward between ticks for as long as the pair overlaps in the
+ * broad-phase
+ */
+USTRUCT(BlueprintType)
+struct TETHERPHYSICS_API FTetherPairCacheEntry
+{
+	GENERATED_BODY()
+
+	FTetherPairCacheEntry()
+		: BroadPhaseState(ETetherContactState::None)
+		, NarrowPhaseState(ETetherContactState::None)
+		, SeparatingAxis(FVector::ZeroVector)
+		, PenetrationDepth(0.f)
+		, PreviousPenetrationDepth(0.f)
+		, BeginTime(0.f)
+		, LastBroadPhaseTick(0)
+		, LastNarrowPhaseTick(0)
+	{}
+
+	FTetherPairCacheEntry(const FTetherShapePair& InPair)
+		: FTetherPairCacheEntry()
+	{
+		Pair = InPair;
+	}
+
+	/** The shapes this entry belongs to */
+	FTetherShapePair Pair;
+
+	/** Whether the bounds of the shapes overlap */
+	UPROPERTY(BlueprintReadOnly, Category=Tether)
+	ETetherContactState BroadPhaseState;
+
+	/** Whether the shapes are in contact */
+	UPROPERTY(BlueprintReadOnly, Category=Tether)
+	ETetherContactState NarrowPhaseState;
+
+	/** Contact normal from the last narrow-phase contact, a starting axis for separating axis and simplex tests */
+	UPROPERTY(BlueprintReadOnly, Category=Tether)
+	FVector SeparatingAxis;
+
+	/** Penetration depth of the current contact */
+	UPROPERTY(BlueprintReadOnly, Category=Tether)
+	float PenetrationDepth;
+
+	/** Penetration depth of the contact on the previous tick, used for warm starting */
+	UPROPERTY(BlueprintReadOnly, Category=Tether)
+	float PreviousPenetrationDepth;
+
+	/** World Time when the current narrow-phase contact began */
+	UPROPERTY(BlueprintReadOnly, Category=Tether)
+	double BeginTime;
+
+	/** Cache tick when the pair last overlapped in the broad-phase */
+	uint64 LastBroadPhaseTick;
+
+	/** Cache tick when the pair was last in contact in the narrow-phase */
+	uint64 LastNarrowPhaseTick;
+
+	/** Final GJK simplex from the last convex narrow-phase test, to warm start the next one */
+	FTetherGJKSimplex Simplex;
+
+	bool IsInContact() const
+	{
+		return NarrowPhaseState == ETetherContactState::Begin || NarrowPhaseState == ETetherContactState::Persist;
+	}
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTetherContactEvent, const FTetherPairCacheEntry& /* Entry */);
+
+/**
+ * A contact event raised during a sub-tick, held until BroadcastContactEvents()
+ */
+struct TETHERPHYSICS_API FTetherPendingContactEvent
+{
+	/** The entry as it was when the event was raised */
+	FTetherPairCacheEntry Entry;
+
+	/** OnContactBegin if true, otherwise OnContactEnd */
+	bool bBegin = false;
+};
+
+/**
+ * Persistent cache of shape pairs keyed by the pair itself (order-independent).
+ *
+ * The broad-phase creates an entry when a pair's bounds begin to overlap, and the entry persists until the overlap
+ * ends, carrying per-pair data such as the last separating axis and previous penetration depth forward for warm
+ * starting. The narrow-phase tracks Begin/Persist/End contact states on the same entries and raises contact events,
+ * so gameplay can subscribe without rescanning the output arrays.
+ *
+ * Stages may run on worker threads, so events are queued and only broadcast by BroadcastContactEvents(), which
+ * FTetherPhysicsPipeline calls on its calling thread once the sub-tick has completed.
+ *
+ * The cache also tracks which shapes were tested or overlapped this tick, for constant time lookups.
+ */
+struct TETHERPHYSICS_API FTetherPairCache
+{
+	/** All pairs whose bounds currently overlap, or stopped overlapping this tick */
+	TMap<FTetherShapePair, FTetherPairCacheEntry> Entries;
+
+	/** Shapes that were part of any potential pair tested by the broad-phase this tick */
+	TSet<const FTetherShape*> BroadPhaseTestedShapes;
+
+	/** Shapes that overlapped another shape in the broad-phase this tick */
+	TSet<const FTetherShape*> BroadPhaseOverlappingShapes;
+
+	/**
+	 * Broadcast when a pair comes into contact in the narrow-phase
+	 * Broadcast after the sub-tick, on the thread that ticked the pipeline, typically the game thread
+	 */
+	FOnTetherContactEvent OnContactBegin;
+
+	/**
+	 * Broadcast when a pair that was in contact separates
+	 * Broadcast after the sub-tick, on the thread that ticked the pipeline, typically the game thread
+	 */
+	FOnTetherContactEvent OnContactEnd;
+
+protected:
+	/** Events raised this sub-tick, in the order they occurred */
+	TArray<FTetherPendingContactEvent> PendingEvents;
+
+	/** Incremented at the start of each broad-phase, used to detect stale entries */
+	uint64 CacheTick = 0;
+
+public:
+	uint64 GetCacheTick() const { return CacheTick; }
+
+	const FTetherPairCacheEntry* Find(const FTetherShapePair& Pair) const { return Entries.Find(Pair); }
+
+	/** Call before the broad-phase tests any pairs */
+	void BeginBroadPhase();
+
+	/** Record a pair as tested, and whether its bounds overlap */
+	FTetherPairCacheEntry* AddBroadPhaseResult(const FTetherShapePair& Pair, bool bOverlapping);
+
+	/** Call after the broad-phase has tested all pairs, ends or removes pairs that were not overlapping */
+	void EndBroadPhase();
+
+	/** Record a narrow-phase contact between a pair */
+	FTetherPairCacheEntry* AddNarrowPhaseContact(const FTetherShapePair& Pair, const FNarrowPhaseCollision& Collision,
+		double WorldTime);
+
+	/** Call after the narrow-phase has tested all pairs, ends contacts that were not found this tick */
+	void EndNarrowPhase();
+
+	/** Broadcast the events raised since the last call, must not run concurrently with the stages */
+	void BroadcastContactEvents();
+
+	void Reset();
+};
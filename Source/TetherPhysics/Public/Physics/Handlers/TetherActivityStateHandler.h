@@ -8,6 +8,7 @@
 #include "TetherActivityStateHandler.generated.h"
 
 struct FTetherDebugText;
+struct FTetherBodyStore;
 
 /**
  * 
@@ -30,6 +31,14 @@ public:
 		const FTetherIO* AngularInputData, const FTetherIO* LinearOutputData, const FTetherIO* AngularOutputData,
 		float DeltaTime, double WorldTime) const;
 
+	/**
+	 * Sleep and wake an island as a unit, call after PostSolveSleep() for every body in the island
+	 * If any body in the island is still awake, every asleep body is woken, so the island only sleeps once all of its
+	 * bodies are at rest. Bodies put to sleep this sub-tick are kept awake quietly with their elapsed timers, bodies
+	 * that were already asleep get a fresh sleep timer. Kinematic and ForceAsleep bodies are left alone.
+	 */
+	static void SynchronizeIsland(const FTetherBodyStore& Bodies, TConstArrayView<int32> Island);
+
 	virtual void DrawDebug(FTetherShape* Shape, const FTetherIO* InputData,
 		TArray<FTetherDebugText>* PendingDebugText = nullptr, float LifeTime = -1.f,
 		FAnimInstanceProxy* Proxy = nullptr, const UWorld* World = nullptr, const FColor& WakeColor = FColor::White,
@@ -66,4 +66,36 @@ public:
 		TArray<FTetherDebugText>* PendingDebugText = nullptr, float LifeTime = -1.f,
 		FAnimInstanceProxy* Proxy = nullptr, const UWorld* World = nullptr, bool bDrawAll = true,
 		const FColor& Color = FColor::Green, bool bPersistentLines = false, float Thickness = 1.f) const {}
+
+protected:
+	/**
+	 * Collision filtering applied before a pair is emitted: pairs of asleep shapes and pairs of kinematic shapes are
+	 * dropped, then collision groups, then the optional ignore matrix
+	 */
+	static bool ShouldPair(const FTetherCollisionIgnoreMatrix* IgnoreMatrix, const FTetherShape* ShapeA,
+		const FTetherShape* ShapeB)
+	{
+		// Asleep shapes don't move, and nothing resolves contacts between kinematic shapes
+		// A kinematic shape is still paired with an asleep one, it may be moved into it and must wake it
+		if ((IsKinematic(ShapeA) && IsKinematic(ShapeB)) || (IsResting(ShapeA) && IsResting(ShapeB)))
+		{
+			return false;
+		}
+		if (!FTetherShape::ShouldCollide(*ShapeA, *ShapeB))
+		{
+			return false;
+		}
+		return !IgnoreMatrix || !IgnoreMatrix->IsIgnored(ShapeA, ShapeB);
+	}
+
+	static bool IsKinematic(const FTetherShape* Shape)
+	{
+		return Shape->SimulationMode == ETetherSimulationMode::Kinematic;
+	}
+
+	/** Asleep and not driven externally */
+	static bool IsResting(const FTetherShape* Shape)
+	{
+		return Shape->IsAsleep() && !IsKinematic(Shape);
+	}
 };
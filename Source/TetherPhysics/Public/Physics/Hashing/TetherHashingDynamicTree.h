@@ -0,0 +1,85 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherHashing.h"
+#include "TetherHashingDynamicTree.generated.h"
+
+
+/**
+ * Dynamic bounding volume hierarchy used in physics simulations.
+ *
+ * UTetherHashingDynamicTree stores every shape's bounds, enlarged by FSpatialHashingInput::DynamicTreeMargin, as a
+ * leaf in a balanced AABB tree that persists in FSpatialHashingOutput between ticks. A shape is only reinserted once
+ * its bounds leave the enlarged box, so small movements cost nothing beyond a containment test.
+ *
+ * Unlike a uniform grid, the tree adapts to shapes of very different sizes, e.g. a large body capsule surrounded by
+ * many small hair spheres, without degrading towards testing all pairs.
+ *
+ * Key Responsibilities:
+ * - Solve: Update the tree and pair shapes whose bounds overlap the enlarged bounds of another shape.
+ * - DrawDebug: Visualize the nodes of the tree.
+ */
+UCLASS(NotBlueprintable)
+class TETHERPHYSICS_API UTetherHashingDynamicTree : public UTetherHashing
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Implements the core logic for pairing or grouping objects/data based on a specific hashing algorithm.
+	 * 
+	 * @param InputData  Pointer to the input data containing objects or data to be hashed.
+	 * @param OutputData Pointer to the output data where the hashing results will be stored.
+	 * @param Origin	 The center of the spatial hashing grid to be applied during the hashing process, if applicable.
+	 * @param DeltaTime  The time step for the simulation, used for time-dependent hashing calculations, if applicable.
+	 * @param WorldTime	 Current WorldTime appended by TimeTicks
+	 */
+	virtual void Solve(const TArray<FTetherShape*>* Shapes, const FTetherIO* InputData, FTetherIO* OutputData,
+		const FTransform& Origin, float DeltaTime, double WorldTime) const override;
+
+protected:
+	static int32 AllocateNode(FTetherDynamicTreeData& Tree);
+	static void FreeNode(FTetherDynamicTreeData& Tree, int32 NodeIndex);
+
+	/** Insert a leaf, choosing the sibling that results in the lowest surface area cost */
+	static void InsertLeaf(FTetherDynamicTreeData& Tree, int32 Leaf);
+
+	/** Remove a leaf from the tree, the node itself remains allocated */
+	static void RemoveLeaf(FTetherDynamicTreeData& Tree, int32 Leaf);
+
+	/** Refit bounds and heights from the given node to the root, balancing along the way */
+	static void Refit(FTetherDynamicTreeData& Tree, int32 NodeIndex);
+
+	/** Perform a left or right rotation if the node is imbalanced, returns the new root of the subtree */
+	static int32 Balance(FTetherDynamicTreeData& Tree, int32 NodeIndex);
+
+	static float GetSurfaceArea(const FBox& Box)
+	{
+		const FVector Size = Box.GetSize();
+		return 2.f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
+
+public:
+	/**
+	 * Visualizes the results of the hashing process for debugging purposes.
+	 * 
+	 * @param Input                Pointer to the input data used in the hashing process.
+	 * @param Output               Pointer to the output data containing the results of the hashing.
+	 * @param Origin			   The center of the spatial hashing grid.
+	 * @param PendingDebugText	   Array of Debug Texts that to be drawn by the viewport
+	 * @param LifeTime             The duration for which the debug lines should be visible.
+	 * @param Proxy				   Pointer to the animation instance proxy for drawing debug information.
+	 * @param World                Pointer to the world context in which the debugging visualization occurs.
+	 * @param bDrawAll             Whether to draw all relevant elements or just those involved in processing.
+	 * @param Color                The color used for drawing the debug visualization.
+	 * @param bPersistentLines     Whether the debug lines should persist beyond a single frame.
+	 * @param Thickness            The thickness of the debug lines.
+	 */
+	virtual void DrawDebug(const TArray<FTetherShape*>* Shapes, const FSpatialHashingInput* Input,
+		const FSpatialHashingOutput* Output, const FTransform& Origin,
+		TArray<FTetherDebugText>* PendingDebugText = nullptr, float LifeTime = -1.f,
+		FAnimInstanceProxy* Proxy = nullptr, const UWorld* World = nullptr, bool bDrawAll = true,
+		const FColor& Color = FColor::Green, bool bPersistentLines = false, float Thickness = 1.f) const override;
+};
@@ -42,17 +42,20 @@ public:
 		const FTransform& Origin, float DeltaTime, double WorldTime) const override;
 
 protected:
-	// Function to add shapes to the spatial hash map
-	static void AddShapeToSpatialHash(const FSpatialHashingInput* Input, FSpatialHashingOutput* Output,
-		int32 ShapeIndex, const FTetherShape* Shape, FString& DebugString);
+	/** Add the shape to every bucket overlapped by its bounds */
+	static void AddShapeToSpatialHash(FSpatialHashingOutput* Output, const FTransform& GridTransform,
+		int32 ShapeIndex, const FBox& Bounds, FString* DebugString = nullptr);
 
-	/** Compute the spatial hash key for a given shape */
-	static FIntVector ComputeSpatialHashKey(const FSpatialHashingInput* Input, const FSpatialHashingOutput* Output,
-		const FTetherShape* Shape, FString& DebugString);
+	/** Compute the spatial hash key for a given position in grid space */
+	static FIntVector ComputeSpatialHashKey(const FVector& GridPosition, const FVector& BucketSize);
 
-	static bool AreBucketsAdjacent(int32 BucketA, int32 BucketB);
-
-	static bool IsInSameOrAdjacentBucket(const FTetherShape* ShapeA, const FTetherShape* ShapeB);
+	/** Compute an order-independent key that uniquely identifies a pair of shape indices */
+	static uint64 ComputeShapePairKey(int32 IndexA, int32 IndexB)
+	{
+		const uint32 Lo = static_cast<uint32>(FMath::Min(IndexA, IndexB));
+		const uint32 Hi = static_cast<uint32>(FMath::Max(IndexA, IndexB));
+		return (static_cast<uint64>(Hi) << 32) | Lo;
+	}
 
 public:
 	static void DrawDebugBucket(FAnimInstanceProxy* Proxy, const UWorld* World, const FTransform& Transform,
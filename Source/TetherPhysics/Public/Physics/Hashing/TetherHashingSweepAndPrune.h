@@ -0,0 +1,77 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherHashing.h"
+#include "TetherHashingSweepAndPrune.generated.h"
+
+
+/**
+ * Incremental sweep and prune system used in physics simulations.
+ *
+ * UTetherHashingSweepAndPrune keeps the min/max endpoints of every shape's bounds sorted along the swept axis,
+ * persisting them in FSpatialHashingOutput between ticks. Shapes attached to a character move coherently from one tick
+ * to the next, so the endpoint list remains nearly sorted and an insertion sort restores them in close to linear time,
+ * rather than rebuilding a spatial hash from scratch.
+ *
+ * Pairs are generated by sweeping the axis with the greatest spread, and testing the remaining two axes for each
+ * shape whose interval is open. Only the swept axis is kept sorted, the endpoints are rebuilt when the axis changes.
+ *
+ * Key Responsibilities:
+ * - Solve: Update the sorted endpoints and pair shapes whose bounds overlap on all three axes.
+ * - DrawDebug: Visualize the bounds that were swept and the resulting pairs.
+ */
+UCLASS(NotBlueprintable)
+class TETHERPHYSICS_API UTetherHashingSweepAndPrune : public UTetherHashing
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Implements the core logic for pairing or grouping objects/data based on a specific hashing algorithm.
+	 * 
+	 * @param InputData  Pointer to the input data containing objects or data to be hashed.
+	 * @param OutputData Pointer to the output data where the hashing results will be stored.
+	 * @param Origin	 The center of the spatial hashing grid to be applied during the hashing process, if applicable.
+	 * @param DeltaTime  The time step for the simulation, used for time-dependent hashing calculations, if applicable.
+	 * @param WorldTime	 Current WorldTime appended by TimeTicks
+	 */
+	virtual void Solve(const TArray<FTetherShape*>* Shapes, const FTetherIO* InputData, FTetherIO* OutputData,
+		const FTransform& Origin, float DeltaTime, double WorldTime) const override;
+
+protected:
+	/** Rebuild the endpoints along the sweep axis from scratch, required when the shapes or the sweep axis change */
+	static void RebuildEndpoints(FTetherSweepAndPruneData& Data);
+
+	/** Refresh endpoint values from the current bounds and restore sort order with an insertion sort */
+	static void UpdateEndpoints(FTetherSweepAndPruneData& Data);
+
+	/**
+	 * Select the axis with the greatest spread of shape centers, which minimizes the number of open intervals.
+	 * The current sweep axis is kept unless another axis exceeds its spread by p.Tether.SweepAndPrune.AxisHysteresis
+	 */
+	static int32 ComputeSweepAxis(const FTetherSweepAndPruneData& Data);
+
+public:
+	/**
+	 * Visualizes the results of the hashing process for debugging purposes.
+	 * 
+	 * @param Input                Pointer to the input data used in the hashing process.
+	 * @param Output               Pointer to the output data containing the results of the hashing.
+	 * @param Origin			   The center of the spatial hashing grid.
+	 * @param PendingDebugText	   Array of Debug Texts that to be drawn by the viewport
+	 * @param LifeTime             The duration for which the debug lines should be visible.
+	 * @param Proxy				   Pointer to the animation instance proxy for drawing debug information.
+	 * @param World                Pointer to the world context in which the debugging visualization occurs.
+	 * @param bDrawAll             Whether to draw all relevant elements or just those involved in processing.
+	 * @param Color                The color used for drawing the debug visualization.
+	 * @param bPersistentLines     Whether the debug lines should persist beyond a single frame.
+	 * @param Thickness            The thickness of the debug lines.
+	 */
+	virtual void DrawDebug(const TArray<FTetherShape*>* Shapes, const FSpatialHashingInput* Input,
+		const FSpatialHashingOutput* Output, const FTransform& Origin,
+		TArray<FTetherDebugText>* PendingDebugText = nullptr, float LifeTime = -1.f,
+		FAnimInstanceProxy* Proxy = nullptr, const UWorld* World = nullptr, bool bDrawAll = true,
+		const FColor& Color = FColor::Green, bool bPersistentLines = false, float Thickness = 1.f) const override;
+};
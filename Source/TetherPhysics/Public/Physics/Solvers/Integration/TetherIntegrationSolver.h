@@ -7,6 +7,9 @@
 #include "UObject/Object.h"
 #include "TetherIntegrationSolver.generated.h"
 
+struct FTetherBodyStore;
+struct FTetherBodyRange;
+
 /**
  * Abstract base class for integration solvers in the Tether physics system.
  * This class is responsible for calculating the physical state of objects over time.
@@ -33,4 +36,15 @@ public:
 	 */
 	virtual void Solve(const FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData,
 		float DeltaTime, double WorldTime) const {}
+
+	/**
+	 * Perform physics integration for every body that uses this solver in a single pass.
+	 * Defaults to calling Solve() for each body, override to integrate directly from the body store.
+	 *
+	 * @param Bodies     Simulation state of every body, velocities must be gathered prior to integrating.
+	 * @param DeltaTime  The time step used for time-dependent calculations.
+	 * @param WorldTime	 Current WorldTime appended by TimeTicks
+	 * @param Range      Bodies to solve, disjoint ranges may be solved concurrently.
+	 */
+	virtual void SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const;
 };
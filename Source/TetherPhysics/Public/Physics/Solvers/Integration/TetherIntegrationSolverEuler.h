@@ -34,4 +34,10 @@ public:
 	 */
 	virtual void Solve(const FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData,
 		float DeltaTime, double WorldTime) const override;
+
+	/**
+	 * Euler integration of every body that uses this solver, reading directly from the body store
+	 * Subclasses that don't override this are solved per-shape, so an overridden Solve() is still used
+	 */
+	virtual void SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const override;
 };
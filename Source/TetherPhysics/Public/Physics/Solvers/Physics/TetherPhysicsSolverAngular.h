@@ -8,6 +8,8 @@
 #include "TetherPhysicsSolverAngular.generated.h"
 
 struct FTetherDebugText;
+struct FTetherBodyStore;
+struct FTetherBodyRange;
 
 /**
  * Physics solver for angular motion in the Tether physics system.
@@ -32,6 +34,10 @@ class TETHERPHYSICS_API UTetherPhysicsSolverAngular : public UObject
 
 protected:
 	static void ApplyAngularDamping(FVector& AngularVelocity, const FAngularInputSettings& Settings, float DeltaTime);
+	static void ApplyAngularDamping(FVector& AngularVelocity, float AngularDamping, ETetherDampingModel DampingModel, float DeltaTime);
+
+	/** Per-shape fallback for SolveAll(), calls Solve() for each body that uses this solver */
+	void SolveEach(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const;
 
 public:
 	/**
@@ -43,6 +49,18 @@ public:
 	 * @param WorldTime	 Current WorldTime appended by TimeTicks
 	 */
 	virtual void Solve(const FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData, float DeltaTime, double WorldTime) const;
+
+	/**
+	 * Perform angular physics calculations for every awake, non-kinematic body that uses this solver in a single pass.
+	 * Subclasses that don't override this are solved per-shape through SolveEach(), so an overridden Solve() is
+	 * always honored.
+	 *
+	 * @param Bodies     Simulation state of every body, gathered prior to solving.
+	 * @param DeltaTime  The time step for the simulation, used to calculate time-dependent angular effects.
+	 * @param WorldTime	 Current WorldTime appended by TimeTicks
+	 * @param Range      Bodies to solve, disjoint ranges may be solved concurrently.
+	 */
+	virtual void SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const;
 	
 	/**
 	 * Visualizes the physics solver's key properties for debugging purposes.
@@ -8,6 +8,8 @@
 #include "TetherPhysicsSolverLinear.generated.h"
 
 struct FTetherDebugText;
+struct FTetherBodyStore;
+struct FTetherBodyRange;
 
 /**
  * Physics solver for linear motion in the Tether physics system.
@@ -32,6 +34,10 @@ class TETHERPHYSICS_API UTetherPhysicsSolverLinear : public UObject
 
 protected:
 	static void ApplyLinearDamping(FVector& Velocity, const FLinearInputSettings& Settings, float DeltaTime);
+	static void ApplyLinearDamping(FVector& Velocity, float LinearDamping, ETetherDampingModel DampingModel, float DeltaTime);
+
+	/** Per-shape fallback for SolveAll(), calls Solve() for each body that uses this solver */
+	void SolveEach(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const;
 	
 public:
 	/**
@@ -44,6 +50,18 @@ public:
 	virtual void Solve(FTetherShape* Shape, const FTetherIO* InputData, FTetherIO* OutputData, float DeltaTime,
 		float WorldTime) const;
 
+	/**
+	 * Perform linear physics calculations for every awake, non-kinematic body that uses this solver in a single pass.
+	 * Subclasses that don't override this are solved per-shape through SolveEach(), so an overridden Solve() is
+	 * always honored.
+	 *
+	 * @param Bodies     Simulation state of every body, gathered prior to solving.
+	 * @param DeltaTime  The time step for the simulation, used to calculate time-dependent linear effects.
+	 * @param WorldTime	 Current WorldTime appended by TimeTicks
+	 * @param Range      Bodies to solve, disjoint ranges may be solved concurrently.
+	 */
+	virtual void SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const;
+
 	/**
 	 * Visualizes the physics solver's key properties for debugging purposes.
 	 * 
@@ -0,0 +1,26 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherPhysicsSolverLinear.h"
+#include "TetherPhysicsSolverLinearSIMD.generated.h"
+
+/**
+ * Vectorized variant of UTetherPhysicsSolverLinear.
+ *
+ * SolveAll() transposes the body store into float lanes and solves four bodies per vector instruction: force and
+ * acceleration, both damping models, quadratic drag and the velocity clamp. Only active bodies are transposed,
+ * simulated and inertial bodies are handled with blend masks rather than branches, so every lane follows the same path.
+ *
+ * Results match the scalar solver to within float precision, the per-shape Solve() is inherited unchanged.
+ * Select it with Tether.Solver.Linear.SIMD to compare against Tether.Solver.Linear.
+ */
+UCLASS(NotBlueprintable)
+class TETHERPHYSICS_API UTetherPhysicsSolverLinearSIMD : public UTetherPhysicsSolverLinear
+{
+	GENERATED_BODY()
+
+public:
+	virtual void SolveAll(FTetherBodyStore& Bodies, float DeltaTime, double WorldTime, const FTetherBodyRange& Range) const override;
+};
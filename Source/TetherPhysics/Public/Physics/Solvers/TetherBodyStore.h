@@ -0,0 +1,163 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherIO.h"
+
+struct FTetherCommonShapeData;
+class UTetherPhysicsSolverLinear;
+class UTetherPhysicsSolverAngular;
+class UTetherIntegrationSolver;
+
+/**
+ * A contiguous range of body indices, used to split batched solves into chunks that can run in parallel
+ * Default constructed, it covers every body
+ */
+struct TETHERPHYSICS_API FTetherBodyRange
+{
+	FTetherBodyRange(int32 InBegin = 0, int32 InEnd = INDEX_NONE)
+		: Begin(InBegin)
+		, End(InEnd)
+	{}
+
+	int32 Begin;
+
+	/** One past the last body, INDEX_NONE for every remaining body */
+	int32 End;
+
+	int32 GetEnd(int32 NumBodies) const { return End == INDEX_NONE ? NumBodies : FMath::Min(End, NumBodies); }
+};
+
+/** Which of the dense body partitions a body belongs to */
+enum class ETetherBodyPartition : uint8
+{
+	Awake,
+	Asleep,
+	Kinematic,
+};
+
+/**
+ * Structure-of-arrays simulation state for every body in the simulation, indexed by FTetherShape::SimulationIndex.
+ *
+ * The per-shape FTetherCommonShapeData remains the authoring source of truth. Each sub-tick the state is gathered
+ * into contiguous arrays, the solvers' SolveAll() process every body in a single loop, and the results are scattered
+ * back to the per-shape outputs so that the rest of the pipeline (activity, narrow phase, debug drawing) is unchanged.
+ *
+ * Shapes may use different solvers, so each body records the solvers it uses and SolveAll() only processes the
+ * bodies that reference it.
+ *
+ * Every body is solved independently of the others, so SolveAll() can be given an FTetherBodyRange and disjoint
+ * ranges solved concurrently.
+ *
+ * Bodies are also kept in dense awake, asleep and kinematic partitions, moved between them as their state changes,
+ * so the per-sub-tick work only visits the bodies that need it. Only awake bodies are gathered and solved.
+ */
+struct TETHERPHYSICS_API FTetherBodyStore
+{
+	/** Source shape and per-shape data for each body */
+	TArray<FTetherShape*> Shapes;
+	TArray<FTetherCommonShapeData*> ShapeData;
+
+	/** Solvers referenced by each body */
+	TArray<const UTetherPhysicsSolverLinear*> LinearSolvers;
+	TArray<const UTetherPhysicsSolverAngular*> AngularSolvers;
+	TArray<const UTetherIntegrationSolver*> IntegrationSolvers;
+
+	/** Each distinct solver referenced by any body, SolveAll() is called once for each */
+	TArray<const UTetherPhysicsSolverLinear*> UniqueLinearSolvers;
+	TArray<const UTetherPhysicsSolverAngular*> UniqueAngularSolvers;
+	TArray<const UTetherIntegrationSolver*> UniqueIntegrationSolvers;
+
+	/** Bodies that are awake and not kinematic, these are the only bodies the linear and angular solvers process */
+	TArray<int32> ActiveBodies;
+
+	/** Dense partitions, unordered, every body is in exactly one of them */
+	TArray<int32> AwakeBodies;
+	TArray<int32> AsleepBodies;
+	TArray<int32> KinematicBodies;
+
+	/** The partition each body is in, and its slot within that partition */
+	TArray<ETetherBodyPartition> Partitions;
+	TArray<int32> PartitionSlots;
+
+	TArray<ETetherSimulationMode> SimulationModes;
+
+	// Transform
+
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+
+	// Linear
+
+	TArray<FVector> LinearVelocities;
+
+	/** Force minus friction force */
+	TArray<FVector> Forces;
+	TArray<FVector> Accelerations;
+	TArray<float> InverseMasses;
+	TArray<float> LinearDamping;
+	TArray<float> LinearDrag;
+	TArray<float> MaxLinearVelocities;
+	TArray<ETetherDampingModel> LinearDampingModels;
+
+	// Angular
+
+	TArray<FVector> AngularVelocities;
+
+	/** Torque about the center of mass, friction torque is not yet applied */
+	TArray<FVector> Torques;
+	TArray<float> FrictionTorques;
+	TArray<FVector> Inertias;
+	TArray<float> AngularDamping;
+	TArray<float> AngularDrag;
+	TArray<float> MaxAngularVelocities;
+	TArray<ETetherDampingModel> AngularDampingModels;
+
+	int32 Num() const { return Shapes.Num(); }
+
+	/** The active bodies that fall within the range, ActiveBodies is sorted so this is a binary search */
+	TConstArrayView<int32> GetActiveBodies(const FTetherBodyRange& Range) const;
+
+	void Reset();
+
+	/**
+	 * Add a body, must be called in SimulationIndex order
+	 * @return The index of the body
+	 */
+	int32 Add(FTetherShape* Shape, FTetherCommonShapeData* Data);
+
+	/** The partition the shape belongs in, based on its simulation mode and activity state */
+	static ETetherBodyPartition GetPartitionFor(const FTetherShape* Shape);
+
+	TArray<int32>& GetPartition(ETetherBodyPartition Partition);
+	const TArray<int32>& GetPartition(ETetherBodyPartition Partition) const;
+
+	/**
+	 * Move the body to the partition matching its current state
+	 * Call after changing a body's SimulationMode or ActivityState from outside the simulation
+	 * @return True if the body moved
+	 */
+	bool UpdatePartition(int32 Index);
+
+	/** Move every body in the partition whose state no longer matches it, e.g. after waking or sleeping bodies */
+	void RefreshPartition(ETetherBodyPartition Partition);
+
+	/**
+	 * Copy the per-shape inputs and current state of the awake bodies into the arrays, call after the activity state
+	 * has been woken and the asleep partition refreshed
+	 */
+	void Gather();
+
+	/** Re-read the applied world transforms, for bodies that weren't awake when gathered */
+	void GatherTransforms(const FTetherBodyRange& Range = {});
+
+	/** Re-read velocities from the per-shape outputs, e.g. after the activity state handler put bodies to sleep */
+	void GatherVelocities(const FTetherBodyRange& Range = {});
+
+	/** Write linear and angular solver results back to the per-shape outputs */
+	void ScatterVelocities(const FTetherBodyRange& Range = {}) const;
+
+	/** Write integrated position and rotation back to the body's integration output */
+	void ScatterTransform(int32 Index) const;
+};
@@ -0,0 +1,77 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FTetherBodyStore;
+struct FNarrowPhaseCollision;
+
+/**
+ * Connected groups of bodies, indexed by FTetherShape::SimulationIndex
+ *
+ * Bodies are joined into an island when they are in contact, or when AddEdge() connects them (e.g. constraints).
+ * Kinematic bodies never join islands, otherwise everything touching the same kinematic body would become a single
+ * island. Islands are built with union-find at the end of each sub-tick, from that sub-tick's narrow-phase contacts,
+ * and used during the next sub-tick.
+ *
+ * Islands never interact with each other, so each is an independent work item, and an island sleeps and wakes as a
+ * unit: a resting pile sleeps only once every body in it is at rest, and waking one body wakes the whole pile.
+ * Sleeping bodies aren't paired with each other, so a sleeping body stays in the island it fell asleep in.
+ */
+struct TETHERPHYSICS_API FTetherIslands
+{
+	/** Start building, every body begins in its own island */
+	void Reset(int32 InNumBodies);
+
+	/** Connect two bodies, ignored if either is kinematic or invalid */
+	void AddEdge(const FTetherBodyStore& Bodies, int32 BodyA, int32 BodyB);
+
+	/** Connect every pair of bodies in contact */
+	void AddContacts(const FTetherBodyStore& Bodies, TConstArrayView<FNarrowPhaseCollision> Collisions);
+
+	/** Group the bodies by island, call after adding every edge */
+	void Finalize();
+
+	/** Reset(), AddContacts() and Finalize() in one, sleeping bodies keep their previous islands */
+	void Build(const FTetherBodyStore& Bodies, TConstArrayView<FNarrowPhaseCollision> Collisions);
+
+	/** Find the islands containing any of the bodies, the only islands that need solving */
+	void GatherActive(TConstArrayView<int32> Bodies);
+
+	/** Islands found by GatherActive(), sorted */
+	TConstArrayView<int32> GetActiveIslands() const { return ActiveIslands; }
+
+	/** True if the islands were built for this number of bodies */
+	bool IsValidFor(int32 InNumBodies) const { return NumBodies == InNumBodies && IslandStarts.Num() > 0; }
+
+	int32 Num() const { return FMath::Max(0, IslandStarts.Num() - 1); }
+
+	/** Body indices in the island */
+	TConstArrayView<int32> GetIsland(int32 Island) const
+	{
+		return TConstArrayView<int32>(IslandBodies.GetData() + IslandStarts[Island], IslandStarts[Island + 1] - IslandStarts[Island]);
+	}
+
+	/** The island containing the body */
+	int32 GetBodyIsland(int32 Body) const { return BodyIslands[Body]; }
+
+protected:
+	int32 Find(int32 Body);
+	void Union(int32 BodyA, int32 BodyB);
+
+	int32 NumBodies = 0;
+
+	/** Union-find forest, with union by rank and path halving */
+	TArray<int32> Parents;
+	TArray<uint8> Ranks;
+
+	/** Island of each body */
+	TArray<int32> BodyIslands;
+
+	/** Bodies grouped by island, IslandStarts holds the offset of each island plus a final end offset */
+	TArray<int32> IslandBodies;
+	TArray<int32> IslandStarts;
+
+	TArray<int32> ActiveIslands;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Shapes/TetherShapeTypeRegistry.h"
 #include "UObject/Object.h"
 #include "TetherShape.generated.h"
 
@@ -33,6 +34,61 @@ enum class ETetherActivityState : uint8
 	ForceAsleep			UMETA(ToolTip="Asleep and not simulated even if disturbed - will not wake"),
 };
 
+/**
+ * World space (or local space, matching the shape) bounds of a tether shape.
+ *
+ * Plain data computed once whenever the shape changes space, so hashing, broad phase and solvers can read the
+ * bounds of any shape without constructing an FTetherShape_AxisAlignedBoundingBox on demand.
+ */
+struct FTetherShapeBounds
+{
+	FTetherShapeBounds() = default;
+
+	FTetherShapeBounds(const FVector& InMin, const FVector& InMax)
+		: Min(InMin)
+		, Max(InMax)
+		, Center((InMin + InMax) * 0.5)
+		, Radius((InMax - InMin).Size() * 0.5)
+	{}
+
+	FTetherShapeBounds(const FVector& InCenter, double InRadius)
+		: Min(InCenter - FVector(InRadius))
+		, Max(InCenter + FVector(InRadius))
+		, Center(InCenter)
+		, Radius(InRadius)
+	{}
+
+	/** Minimum corner of the axis-aligned bounds */
+	FVector Min = FVector::ZeroVector;
+
+	/** Maximum corner of the axis-aligned bounds */
+	FVector Max = FVector::ZeroVector;
+
+	/** Center of the bounding sphere */
+	FVector Center = FVector::ZeroVector;
+
+	/** Radius of the bounding sphere */
+	double Radius = 0.0;
+
+	FVector GetExtents() const { return (Max - Min) * 0.5; }
+	FBox GetBox() const { return FBox(Min, Max); }
+
+	/** Axis-aligned overlap test */
+	bool Intersects(const FTetherShapeBounds& Other, double Tolerance = KINDA_SMALL_NUMBER) const
+	{
+		return (Min.X <= Other.Max.X + Tolerance && Max.X >= Other.Min.X - Tolerance) &&
+			   (Min.Y <= Other.Max.Y + Tolerance && Max.Y >= Other.Min.Y - Tolerance) &&
+			   (Min.Z <= Other.Max.Z + Tolerance && Max.Z >= Other.Min.Z - Tolerance);
+	}
+
+	/** Axis-aligned bounds vs sphere overlap test */
+	bool IntersectsSphere(const FVector& SphereCenter, double SphereRadius) const
+	{
+		const FVector ClosestPoint = ClampVector(SphereCenter, Min, Max);
+		return FVector::DistSquared(ClosestPoint, SphereCenter) <= FMath::Square(SphereRadius + KINDA_SMALL_NUMBER);
+	}
+};
+
 /**
  * The settings and data container for a tether shape in the Tether physics system.
  *
@@ -130,21 +186,43 @@ public:
 	UPROPERTY()
 	int32 HashIndex = 0;
 
-	/** Cache local space data to avoid precision or rounding data loss over time */
-	TSharedPtr<FTetherShape> LocalSpaceData = nullptr;
+	/**
+	 * Dense index of the shape within the simulation's shape array, assigned by whoever owns that array
+	 * Solver outputs are stored in parallel arrays indexed by this, so lookups never need to hash the shape
+	 */
+	UPROPERTY()
+	int32 SimulationIndex = INDEX_NONE;
 
-	/** Shapes that should be ignored during collision detection @TODO actually implement this */
+	/** Shapes that should be ignored during collision detection, resolved into CollisionMask */
 	UPROPERTY()
 	TArray<TWeakObjectPtr<UTetherShapeObject>> IgnoredShapes;
 
-	/** Tags to categorize shapes that should be ignored during collision detection @TODO actually implement this */
+	/** Tags to categorize shapes that should be ignored during collision detection, resolved into CollisionMask */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
 	FGameplayTagContainer IgnoredShapeTypes;
 
+	/** Collision groups this shape belongs to, one bit per shape type ID. Zero until ResolveCollisionFilter() */
+	UPROPERTY()
+	uint32 CollisionGroup = 0;
+
+	/** Collision groups this shape will collide with */
+	UPROPERTY()
+	uint32 CollisionMask = 0;
+
 	UTetherShapeObject* GetTetherShapeObject() const;
 	FGameplayTag GetShapeType() const;
 	static FGameplayTag StaticShapeType() { return FGameplayTag::EmptyTag; }
 
+	/**
+	 * Compact shape type ID used to index the collision dispatch tables
+	 * Built-in shapes resolve it on construction, custom shapes when ResolveCollisionFilter() is called
+	 * Never written by the getter, so it is safe to read from the worker threads
+	 */
+	uint8 GetShapeTypeId() const { return ShapeTypeId; }
+
+	/** Resolves the cached shape type ID from GetShapeType() */
+	void ResolveShapeTypeId();
+
 	FString GetName() const;
 	FName GetFName() const { return FName(GetName()); }
 
@@ -157,6 +235,31 @@ public:
 	/** Checks if two shapes are set to ignore each other */
 	static bool AreShapesIgnoringEachOther(const FTetherShape& ShapeA, const FTetherShape& ShapeB);
 
+	/**
+	 * Resolves CollisionGroup and CollisionMask from the shape type, IgnoredShapes and IgnoredShapeTypes
+	 * Call when the shape is registered with a simulation, and again whenever IsCollisionFilterResolved() fails
+	 * Invalid shapes resolve to no group, and never collide
+	 */
+	void ResolveCollisionFilter();
+
+	/** False until ResolveCollisionFilter() is called, and again once the shape type or ignore settings change */
+	bool IsCollisionFilterResolved() const
+	{
+		return bCollisionFilterResolved && CollisionFilterHash == ComputeCollisionFilterHash();
+	}
+
+	/** Hash of everything the collision filter is resolved from */
+	uint32 ComputeCollisionFilterHash() const;
+
+	/**
+	 * Bitmask equivalent of !AreShapesIgnoringEachOther(), valid once both filters are resolved
+	 * Cheap enough to run inside the hashing loops before a pair is emitted
+	 */
+	static bool ShouldCollide(const FTetherShape& ShapeA, const FTetherShape& ShapeB)
+	{
+		return (ShapeA.CollisionGroup & ShapeB.CollisionMask) != 0 && (ShapeB.CollisionGroup & ShapeA.CollisionMask) != 0;
+	}
+
 	/** Returns whether the shape is currently in world space */
 	bool IsWorldSpace() const { return bWorldSpace; }
 
@@ -166,6 +269,18 @@ public:
 	/** Converts the shape's data back to local space */
 	void ToLocalSpace();
 
+	/**
+	 * Cached bounds in the shape's current space, refreshed by ToWorldSpace() and ToLocalSpace()
+	 * Call UpdateBounds() after modifying the shape's data directly
+	 */
+	const FTetherShapeBounds& GetBounds() const { return Bounds; }
+
+	/** Recomputes the cached bounds from the shape's current data */
+	void UpdateBounds();
+
+	/** Furthest point on the shape in the given direction, see UTetherShapeObject::GetSupportPoint() */
+	FVector GetSupportPoint(const FVector& Direction) const;
+
 	/** Returns the shape's world transformation that was applied to convert from local space */
 	const FTransform& GetAppliedWorldTransform() const { return AppliedWorldTransform; }
 
@@ -178,6 +293,16 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category=Tether)
 	bool bWorldSpace = false;
 
+	/** Cached result of ResolveShapeTypeId() */
+	uint8 ShapeTypeId = FTetherShapeTypeRegistry::InvalidShapeTypeId;
+
+	/** Cached result of UTetherShapeObject::ComputeBounds() */
+	FTetherShapeBounds Bounds;
+
+	/** Hash of the shape type and ignore settings that CollisionGroup and CollisionMask were resolved from */
+	uint32 CollisionFilterHash = 0;
+	bool bCollisionFilterResolved = false;
+
 public:
 	/** Draws the shape for debugging purposes using the animation instance proxy */
 	void DrawDebug(const UWorld* World, FAnimInstanceProxy* Proxy, const FColor& Color = FColor::Red,
@@ -187,9 +312,10 @@ public:
 /**
  * A simple struct representing a pair of shapes for collision detection.
  *
- * FTetherShapePair is used to store the indices of two shapes that are to be tested for collisions
- * in the physics simulation. It includes a method to check if two pairs are equal, regardless of the order
- * of the shapes, making it useful for identifying and managing unique collision pairs.
+ * FTetherShapePair stores two shapes that are to be tested for collisions in the physics simulation.
+ * The simulation indices are captured when the pair is created, so consumers can index parallel solver output arrays
+ * directly. The shape pointers remain for consumers without access to the shape array.
+ * Pairs compare equal regardless of the order of the shapes, which is useful for managing unique collision pairs.
  */
 USTRUCT(BlueprintType)
 struct TETHERPHYSICS_API FTetherShapePair
@@ -199,9 +325,15 @@ struct TETHERPHYSICS_API FTetherShapePair
 	FTetherShape* ShapeA;
 	FTetherShape* ShapeB;
 
+	/** FTetherShape::SimulationIndex of each shape */
+	int32 IndexA;
+	int32 IndexB;
+
 	FTetherShapePair()
 		: ShapeA(nullptr)
 		, ShapeB(nullptr)
+		, IndexA(INDEX_NONE)
+		, IndexB(INDEX_NONE)
 	{}
 
 	/** 
@@ -212,6 +344,8 @@ struct TETHERPHYSICS_API FTetherShapePair
 	FTetherShapePair(FTetherShape* InShapeA, FTetherShape* InShapeB)
 		: ShapeA(InShapeA)
 		, ShapeB(InShapeB)
+		, IndexA(InShapeA ? InShapeA->SimulationIndex : INDEX_NONE)
+		, IndexB(InShapeB ? InShapeB->SimulationIndex : INDEX_NONE)
 	{}
 
 	bool ContainsShape(const FTetherShape* Shape) const
@@ -231,6 +365,64 @@ struct TETHERPHYSICS_API FTetherShapePair
 		return (ShapeA == Other.ShapeA && ShapeB == Other.ShapeB) ||
 			   (ShapeA == Other.ShapeB && ShapeB == Other.ShapeA);
 	}
+
+	/** Order-independent hash, consistent with operator== */
+	friend uint32 GetTypeHash(const FTetherShapePair& Pair)
+	{
+		const UPTRINT A = reinterpret_cast<UPTRINT>(Pair.ShapeA);
+		const UPTRINT B = reinterpret_cast<UPTRINT>(Pair.ShapeB);
+		return HashCombine(GetTypeHash(FMath::Min(A, B)), GetTypeHash(FMath::Max(A, B)));
+	}
+};
+
+/**
+ * Explicit shape pair exclusions, e.g. adjacent bodies in a chain.
+ *
+ * Complements the per-type CollisionGroup/CollisionMask filter for individual pairs that should never collide.
+ * Pairs are registered by shape, so they stay correct when the owner reassigns SimulationIndex after adding or removing
+ * shapes. Build() flattens them into a symmetric bit matrix indexed by SimulationIndex whenever the pairs or the
+ * shapes change, so a lookup inside the hashing loops is a single bit test.
+ */
+struct TETHERPHYSICS_API FTetherCollisionIgnoreMatrix
+{
+	/** Exclude the pair from collision detection */
+	void Ignore(FTetherShape* ShapeA, FTetherShape* ShapeB);
+
+	/** Replace every exclusion, only rebuilds the matrix if they differ from the current ones */
+	void SetIgnoredPairs(TSet<FTetherShapePair>&& InIgnoredPairs);
+
+	/** Remove every exclusion involving the shape, call before the shape is destroyed */
+	void RemoveShape(const FTetherShape* Shape);
+
+	void Reset();
+
+	/**
+	 * Flatten the exclusions into the bit matrix if they, or the shapes' SimulationIndex, changed since the last build
+	 * @param Shapes  Every shape in the simulation, indexed by SimulationIndex
+	 */
+	void Build(const TArray<FTetherShape*>& Shapes);
+
+	/** Valid once Build() has been called with the shapes being paired, each indexed by its SimulationIndex */
+	bool IsIgnored(const FTetherShape* ShapeA, const FTetherShape* ShapeB) const
+	{
+		return NumIgnored > 0 && IsValidIndex(ShapeA->SimulationIndex) && IsValidIndex(ShapeB->SimulationIndex) &&
+			Bits[ShapeA->SimulationIndex * NumShapes + ShapeB->SimulationIndex];
+	}
+
+	bool IsEmpty() const { return IgnoredPairs.IsEmpty(); }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < NumShapes; }
+
+protected:
+	/** Exclusions keyed by shape, the source of truth for the bit matrix */
+	TSet<FTetherShapePair> IgnoredPairs;
+
+	/** Shape at each SimulationIndex when the matrix was last built */
+	TArray<const FTetherShape*> BuiltShapes;
+
+	TBitArray<> Bits;
+	int32 NumShapes = 0;
+	int32 NumIgnored = 0;
+	bool bDirty = true;
 };
 
 /**
@@ -266,6 +458,19 @@ public:
 	/** Gets the shape as a bounding box */
 	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const;
 
+	/**
+	 * Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds()
+	 * The default implementation falls back to GetBoundingBox(), override to avoid constructing a shape
+	 */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const;
+
+	/**
+	 * Furthest point on the shape in the given direction, used by FTetherGJK to collide any pair of shapes
+	 * Direction need not be normalized. Concave shapes return the support point of their convex hull
+	 * The default implementation uses the cached bounds, override for anything that isn't an axis-aligned box
+	 */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const;
+
 	/** Gets the shape identifier for debugging purposes */
 	virtual FString GetShapeDebugString() const { return GetShapeType().ToString(); }
 
@@ -0,0 +1,33 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Maps shape type gameplay tags to compact integer IDs.
+ *
+ * Tags are expensive to compare repeatedly, so each shape resolves its tag to an ID once and the collision
+ * handler indexes its dispatch tables with it. IDs are assigned in registration order and are only stable
+ * for the lifetime of the process, they must never be serialized.
+ */
+struct TETHERPHYSICS_API FTetherShapeTypeRegistry
+{
+	/** Maximum number of shape types that can be registered, sizes the collision dispatch tables */
+	static constexpr uint8 MaxShapeTypes = 16;
+
+	/** Returned for empty tags, or when the registry is full */
+	static constexpr uint8 InvalidShapeTypeId = 0xFF;
+
+	/** Returns the ID for the shape type, registering it if this is the first time it has been seen */
+	static uint8 GetShapeTypeId(const FGameplayTag& ShapeType);
+
+	/** Returns the shape type registered with the ID, or an empty tag */
+	static FGameplayTag GetShapeType(uint8 ShapeTypeId);
+
+	/** Number of registered shape types */
+	static int32 Num();
+
+	static bool IsValidId(uint8 ShapeTypeId) { return ShapeTypeId < MaxShapeTypes; }
+};
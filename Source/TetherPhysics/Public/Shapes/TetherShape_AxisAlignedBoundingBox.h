@@ -7,6 +7,16 @@
 #include "TetherShape.h"
 #include "TetherShape_AxisAlignedBoundingBox.generated.h"
 
+/**
+ * Local space parameters of an AABB, stored inline on the shape
+ * World space data is computed directly from these and the applied transform
+ */
+struct FTetherAABBLocalSpace
+{
+	FVector Min = FVector::ZeroVector;
+	FVector Max = FVector::ZeroVector;
+};
+
 /**
  * Represents an Axis-Aligned Bounding Box (AABB) in the Tether physics system.
  *
@@ -39,8 +49,17 @@ struct TETHERPHYSICS_API FTetherShape_AxisAlignedBoundingBox : public FTetherSha
 
 	FVector GetBoxExtents() const {	return (Max - Min) * 0.5f; }
 	
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
 	void ToLocalSpace_Implementation();
 
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherAABBLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
+
 	FVector ComputeCenter() const;
 	
 	/** Minimum corner of the AABB, representing the smallest x, y, and z coordinates */
@@ -80,6 +99,9 @@ public:
 	/** Gets the shape as a bounding box */
 	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
 
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
 	/** Draws the shape for debugging purposes */
 	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
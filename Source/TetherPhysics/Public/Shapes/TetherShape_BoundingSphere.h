@@ -7,6 +7,16 @@
 #include "TetherShape.h"
 #include "TetherShape_BoundingSphere.generated.h"
 
+/**
+ * Local space parameters of a Bounding Sphere, stored inline on the shape
+ * World space data is computed directly from these and the applied transform
+ */
+struct FTetherBoundingSphereLocalSpace
+{
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.f;
+};
+
 /**
  * Represents a Bounding Sphere in the Tether physics system.
  *
@@ -32,8 +42,17 @@ struct TETHERPHYSICS_API FTetherShape_BoundingSphere : public FTetherShape
 	/** Returns the gameplay tag associated with this shape type */
 	static FGameplayTag StaticShapeType() { return FTetherGameplayTags::Tether_Shape_BoundingSphere; }
 
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
 	void ToLocalSpace_Implementation();
 
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherBoundingSphereLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
+
 	FTetherShape_AxisAlignedBoundingBox GetBoundingBox() const;
 	
 	/** Center of the sphere */
@@ -73,6 +92,12 @@ public:
 	/** Gets the shape as a bounding box */
 	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
 
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
+	/** Furthest point on the shape in the given direction */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const override;
+
 	/** Draws the shape for debugging purposes */
 	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
@@ -8,6 +8,18 @@
 #include "TetherShape_AxisAlignedBoundingBox.h"
 #include "TetherShape_Capsule.generated.h"
 
+/**
+ * Local space parameters of a Capsule, stored inline on the shape
+ * World space data is computed directly from these and the applied transform
+ */
+struct FTetherCapsuleLocalSpace
+{
+	FVector Center = FVector::ZeroVector;
+	float HalfHeight = 0.f;
+	float Radius = 0.f;
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
 /**
  * Represents a Capsule shape in the Tether physics system.
  *
@@ -33,10 +45,27 @@ struct TETHERPHYSICS_API FTetherShape_Capsule : public FTetherShape
 	/** Returns the gameplay tag associated with this shape type */
 	static FGameplayTag StaticShapeType() { return FTetherGameplayTags::Tether_Shape_Capsule; }
 
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
 	void ToLocalSpace_Implementation();
 
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherCapsuleLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
+
 	FTetherShape_AxisAlignedBoundingBox GetBoundingBox() const;
 
+	/** The line segment between the centers of the hemispheres */
+	void GetSegment(FVector& OutBottom, FVector& OutTop) const
+	{
+		const FVector Extent = Rotation.RotateVector(FVector::UpVector) * (HalfHeight - Radius);
+		OutBottom = Center - Extent;
+		OutTop = Center + Extent;
+	}
+
 	/** Center of the capsule */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
 	FVector Center;
@@ -83,6 +112,12 @@ public:
 	/** Gets the shape as a bounding box */
 	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
 
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
+	/** Furthest point on the shape in the given direction */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const override;
+
 	/** Draws the shape for debugging purposes */
 	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
@@ -0,0 +1,169 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherGameplayTags.h"
+#include "TetherShape.h"
+#include "TetherShape_AxisAlignedBoundingBox.h"
+#include "TetherShape_BoundingSphere.h"
+#include "TetherShape_Capsule.h"
+#include "TetherShape_ConvexHull.h"
+#include "TetherShape_OrientedBoundingBox.h"
+#include "TetherShape_Compound.generated.h"
+
+/**
+ * Local space parameters of a Compound, stored inline on the shape
+ * The children each cache their own local space data
+ */
+struct FTetherCompoundLocalSpace
+{
+	FVector Center = FVector::ZeroVector;
+};
+
+/**
+ * Node of the bounding volume hierarchy over a compound's children
+ * Nodes are stored depth first, so an internal node's first child node immediately follows it
+ */
+struct FTetherCompoundNode
+{
+	/** Bounds of every child beneath the node, in the compound's current space */
+	FTetherShapeBounds Bounds;
+
+	/** Child shape of a leaf, INDEX_NONE for internal nodes */
+	int32 Child = INDEX_NONE;
+
+	/** Second child node of an internal node */
+	int32 Right = INDEX_NONE;
+
+	bool IsLeaf() const { return Child != INDEX_NONE; }
+};
+
+/**
+ * Represents a Compound shape in the Tether physics system.
+ *
+ * A Compound groups several primitives into a single simulated body, for objects that no single primitive fits.
+ * Only the compound is hashed, so the broad-phase sees one bounds per compound and its children never generate pairs
+ * with each other. The narrow-phase descends a small bounding volume hierarchy over the children, testing only those
+ * that overlap the other shape, and keeps the deepest contact.
+ *
+ * The children share the compound's space: they are transformed to world space together, and their positions are
+ * relative to whatever the compound itself is relative to. The hierarchy's topology is built once from the children's
+ * local space bounds, then refit whenever the compound is transformed.
+ */
+USTRUCT(BlueprintType)
+struct TETHERPHYSICS_API FTetherShape_Compound : public FTetherShape
+{
+	GENERATED_BODY()
+
+	FTetherShape_Compound();
+
+	/** Creates a clone of the Compound shape, preserving its specific type and data */
+	virtual TSharedPtr<FTetherShape> Clone() const override { return MakeShared<FTetherShape_Compound>(*this); }
+
+	/** Returns the gameplay tag associated with this shape type */
+	static FGameplayTag StaticShapeType() { return FTetherGameplayTags::Tether_Shape_Compound; }
+
+	/** Cheaper than FTetherShapeCaster::IsChildOf(), compares the shape type IDs */
+	static bool IsCompound(const FTetherShape& Shape);
+
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherCompoundLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
+
+	FTetherShape_AxisAlignedBoundingBox GetBoundingBox() const;
+
+	/** Rebuilds the hierarchy from the children, call after adding or removing children while in local space */
+	void BuildTree();
+
+	/** Recomputes the bounds of every node from the children's current bounds */
+	void RefitTree();
+
+	/** Builds the hierarchy once the children are loaded */
+	void PostSerialize(const FArchive& Ar);
+
+	int32 NumChildren() const { return Spheres.Num() + Capsules.Num() + Boxes.Num() + ConvexHulls.Num(); }
+
+	/** Children are indexed across Spheres, Capsules, Boxes and ConvexHulls in that order */
+	FTetherShape& GetChild(int32 Index);
+	const FTetherShape& GetChild(int32 Index) const { return const_cast<FTetherShape_Compound*>(this)->GetChild(Index); }
+
+	/** Calls Func for every child whose bounds overlap the given bounds */
+	void ForEachOverlappingChild(const FTetherShapeBounds& InBounds, TFunctionRef<void(const FTetherShape&)> Func) const;
+
+	TConstArrayView<FTetherCompoundNode> GetNodes() const { return Nodes; }
+
+	/** Sphere children */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	TArray<FTetherShape_BoundingSphere> Spheres;
+
+	/** Capsule children */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	TArray<FTetherShape_Capsule> Capsules;
+
+	/** Oriented box children */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	TArray<FTetherShape_OrientedBoundingBox> Boxes;
+
+	/** Convex hull children */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	TArray<FTetherShape_ConvexHull> ConvexHulls;
+
+protected:
+	/** Builds the subtree over Children[First, First + Count), returns the index of its root node */
+	int32 BuildNode(TArray<int32>& Children, int32 First, int32 Count);
+
+	TArray<FTetherCompoundNode> Nodes;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTetherShape_Compound> : public TStructOpsTypeTraitsBase2<FTetherShape_Compound>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
+
+/**
+ * Defines the behavior and operations for a Compound in the Tether physics system.
+ *
+ * This class provides the necessary virtual functions for managing and manipulating Compound shapes, forwarding
+ * transformations and debugging visualizations to each child.
+ */
+UCLASS()
+class TETHERPHYSICS_API UTetherShapeObject_Compound : public UTetherShapeObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the gameplay tag that identifies the type of shape */
+	virtual FGameplayTag GetShapeType() const override { return FTetherGameplayTags::Tether_Shape_Compound; }
+
+	/** Returns the center of the shape in local space */
+	virtual FVector GetLocalSpaceShapeCenter(const FTetherShape& Shape) const override;
+
+	/** Transforms the shape data from local space to world space */
+	virtual void TransformToWorldSpace(FTetherShape& Shape, const FTransform& WorldTransform) const override;
+
+	/** Transforms the shape data from world space back to local space */
+	virtual void TransformToLocalSpace(FTetherShape& Shape) const override;
+
+	/** Gets the shape as a bounding box */
+	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
+
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
+	/** Furthest point on any child in the given direction, the support point of the children's convex hull */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const override;
+
+	/** Draws the shape for debugging purposes */
+	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
+		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
+};
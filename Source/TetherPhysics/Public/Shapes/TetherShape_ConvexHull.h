@@ -0,0 +1,188 @@
+﻿// Copyright (c) Jared Taylor. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TetherGameplayTags.h"
+#include "TetherShape.h"
+#include "TetherShape_AxisAlignedBoundingBox.h"
+#include "TetherShape_ConvexHull.generated.h"
+
+/**
+ * Local space parameters of a Convex Hull, stored inline on the shape
+ * World space data is computed directly from these and the applied transform
+ */
+struct FTetherConvexHullLocalSpace
+{
+	FVector Center = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector Scale = FVector::OneVector;
+};
+
+/**
+ * Hull geometry built once from a point cloud, in the shape's unscaled local space
+ *
+ * Immutable once built and shared between every copy of the shape, so cloning a hull into a simulation doesn't copy
+ * its vertices. The vertex adjacency lets support queries hill-climb along the hull's edges from a nearby vertex
+ * instead of testing every vertex.
+ */
+struct TETHERPHYSICS_API FTetherConvexHullData
+{
+	/** Vertices of the hull, interior and duplicate points removed */
+	TArray<FVector> Vertices;
+
+	/** Outward facing planes of the hull's faces, empty if the points are flat */
+	TArray<FPlane> Planes;
+
+	/** Neighbors of each vertex along the hull's edges, AdjacencyStarts holds the offset of each vertex plus a final end offset */
+	TArray<int32> Adjacency;
+	TArray<int32> AdjacencyStarts;
+
+	/** Build the hull of the points, returns nullptr if there are none */
+	static TSharedPtr<const FTetherConvexHullData> Build(TConstArrayView<FVector> Points);
+
+	int32 Num() const { return Vertices.Num(); }
+
+	TConstArrayView<int32> GetNeighbors(int32 Vertex) const
+	{
+		return TConstArrayView<int32>(Adjacency.GetData() + AdjacencyStarts[Vertex], AdjacencyStarts[Vertex + 1] - AdjacencyStarts[Vertex]);
+	}
+
+	/**
+	 * Index of the vertex furthest along the local space direction
+	 * Climbs from StartVertex to whichever neighbor is further along the direction until none are, which on a convex
+	 * hull is the furthest vertex overall. Starting from the previous result makes coherent queries nearly free.
+	 */
+	int32 FindSupportVertex(const FVector& Direction, int32 StartVertex = 0) const;
+
+	/** True if the local space point is on or inside every face */
+	bool IsInside(const FVector& Point, float Tolerance = KINDA_SMALL_NUMBER) const;
+
+protected:
+	/** Every vertex is a neighbor of every other, for point clouds too flat to build faces from */
+	void BuildFullAdjacency();
+};
+
+/**
+ * Represents a Convex Hull shape in the Tether physics system.
+ *
+ * The hull is built from an arbitrary set of points when the shape is constructed or loaded, so a single shape can
+ * closely fit objects that would otherwise need several boxes or capsules stacked together. Points are relative to the
+ * Center, and are rotated and scaled by Rotation and Scale.
+ *
+ * There are no dedicated collision routines for hulls, every pair is resolved through FTetherGJK using the hull's
+ * support function.
+ */
+USTRUCT(BlueprintType)
+struct TETHERPHYSICS_API FTetherShape_ConvexHull : public FTetherShape
+{
+	GENERATED_BODY()
+
+	FTetherShape_ConvexHull();
+
+	FTetherShape_ConvexHull(const FVector& InCenter, const TArray<FVector>& InPoints, const FRotator& InRotation,
+		const FVector& InScale = FVector::OneVector);
+
+	/** Creates a clone of the Convex Hull shape, preserving its specific type and data */
+	virtual TSharedPtr<FTetherShape> Clone() const override { return MakeShared<FTetherShape_ConvexHull>(*this); }
+
+	/** Returns the gameplay tag associated with this shape type */
+	static FGameplayTag StaticShapeType() { return FTetherGameplayTags::Tether_Shape_ConvexHull; }
+
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
+	void ToLocalSpace_Implementation();
+
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherConvexHullLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
+
+	FTetherShape_AxisAlignedBoundingBox GetBoundingBox() const;
+
+	/** Rebuilds the hull from Points, call after modifying them */
+	void BuildHull();
+
+	/** Builds the hull once the points are loaded */
+	void PostSerialize(const FArchive& Ar);
+
+	/** The hull built from Points, nullptr if there are none */
+	const FTetherConvexHullData* GetHull() const { return Hull.Get(); }
+
+	/** Furthest point on the hull in the given world space direction */
+	FVector GetSupportPoint(const FVector& Direction) const;
+
+	/** Transforms a point of the hull into the shape's current space */
+	FVector TransformHullPoint(const FVector& Point) const { return Center + Rotation.RotateVector(Point * Scale); }
+
+	/** Center of the Convex Hull */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	FVector Center;
+
+	/** Rotation of the Convex Hull */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	FRotator Rotation;
+
+	/** Scale applied to the points */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	FVector Scale;
+
+	/** Points to build the hull from, relative to the Center. Points inside the hull are discarded */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
+	TArray<FVector> Points;
+
+protected:
+	TSharedPtr<const FTetherConvexHullData> Hull;
+
+	/** Vertex that answered the last support query, where the next one starts climbing from */
+	mutable int32 SupportVertex = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTetherShape_ConvexHull> : public TStructOpsTypeTraitsBase2<FTetherShape_ConvexHull>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
+
+/**
+ * Defines the behavior and operations for a Convex Hull in the Tether physics system.
+ *
+ * This class provides the necessary virtual functions for managing and manipulating Convex Hull shapes,
+ * including transformations between local and world space, as well as debugging visualizations.
+ */
+UCLASS()
+class TETHERPHYSICS_API UTetherShapeObject_ConvexHull : public UTetherShapeObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the gameplay tag that identifies the type of shape */
+	virtual FGameplayTag GetShapeType() const override { return FTetherGameplayTags::Tether_Shape_ConvexHull; }
+
+	/** Returns the center of the shape in local space */
+	virtual FVector GetLocalSpaceShapeCenter(const FTetherShape& Shape) const override;
+
+	/** Transforms the shape data from local space to world space */
+	virtual void TransformToWorldSpace(FTetherShape& Shape, const FTransform& WorldTransform) const override;
+
+	/** Transforms the shape data from world space back to local space */
+	virtual void TransformToLocalSpace(FTetherShape& Shape) const override;
+
+	/** Gets the shape as a bounding box */
+	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
+
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
+	/** Furthest point on the shape in the given direction */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const override;
+
+	/** Draws the shape for debugging purposes */
+	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
+		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
+};
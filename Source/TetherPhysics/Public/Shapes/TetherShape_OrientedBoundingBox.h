@@ -8,6 +8,17 @@
 #include "TetherShape_AxisAlignedBoundingBox.h"
 #include "TetherShape_OrientedBoundingBox.generated.h"
 
+/**
+ * Local space parameters of an OBB, stored inline on the shape
+ * World space data is computed directly from these and the applied transform
+ */
+struct FTetherOBBLocalSpace
+{
+	FVector Center = FVector::ZeroVector;
+	FVector Extent = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
 /**
  * Represents an Oriented Bounding Box (OBB) in the Tether physics system.
  *
@@ -33,7 +44,16 @@ struct TETHERPHYSICS_API FTetherShape_OrientedBoundingBox : public FTetherShape
 	/** Returns the gameplay tag associated with this shape type */
 	static FGameplayTag StaticShapeType() { return FTetherGameplayTags::Tether_Shape_OrientedBoundingBox; }
 
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
 	void ToLocalSpace_Implementation();
+
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherOBBLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
 	
 	/** Center of the OBB */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
@@ -110,6 +130,12 @@ public:
 	/** Gets the shape as a bounding box */
 	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
 
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
+	/** Furthest point on the shape in the given direction */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const override;
+
 	/** Draws the shape for debugging purposes */
 	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
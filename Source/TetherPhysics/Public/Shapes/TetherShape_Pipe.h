@@ -8,6 +8,120 @@
 #include "TetherShape_AxisAlignedBoundingBox.h"
 #include "TetherShape_Pipe.generated.h"
 
+struct FTetherShape_Pipe;
+
+/**
+ * Local space parameters of a Pipe, stored inline on the shape
+ * World space data is computed directly from these and the applied transform
+ */
+struct FTetherPipeLocalSpace
+{
+	FVector Center = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float OuterRadius = 0.f;
+	float InnerRadius = 0.f;
+	float Thickness = 0.f;
+};
+
+/**
+ * World space frame of a Pipe, computed once per query so closest-point tests don't repeat the rotation
+ *
+ * The pipe is treated as a solid annular sector: radially between InnerRadius and OuterRadius, along the Up axis
+ * within half the thickness either side of the center, and angularly from Forward towards Right by ArcAngle.
+ * Point queries are closed-form, no sampling along the arc. Convex shapes without a closed-form routine collide with
+ * the arc split into convex segments.
+ */
+struct TETHERPHYSICS_API FTetherPipeGeometry
+{
+	explicit FTetherPipeGeometry(const FTetherShape_Pipe& Pipe);
+
+	FVector Center;
+	FVector Forward;
+	FVector Right;
+	FVector Up;
+	float InnerRadius;
+	float OuterRadius;
+	float HalfThickness;
+	float ArcRadians;
+
+	/** Direction of the end of the arc in the pipe's plane, the start is always along Forward */
+	FVector2D EndDirection;
+
+	bool IsFullCircle() const { return ArcRadians >= UE_TWO_PI - KINDA_SMALL_NUMBER; }
+
+	/**
+	 * Closest point on the pipe to the world space point
+	 * @param bOutInside True if the point is inside the pipe, in which case it is returned unchanged
+	 */
+	FVector GetClosestPoint(const FVector& Point, bool& bOutInside) const;
+
+	/**
+	 * For a point inside the pipe, the distance to the nearest face
+	 * @param OutNormal Outward world space normal of that face
+	 */
+	float GetPenetration(const FVector& Point, FVector& OutNormal) const;
+
+	/** Furthest point in the given world space direction, on the convex hull if the pipe is a partial arc */
+	FVector GetSupportPoint(const FVector& Direction) const;
+
+	/** Angle of the world space point around the Up axis, from 0 to 2PI */
+	float GetArcAngle(const FVector& Point) const { return GetAngle(ToLocal(Point)); }
+
+	/** World space direction away from the axis at the given angle */
+	FVector GetRadialDirection(float Angle) const;
+
+	/** World space direction along the arc at the given angle, towards increasing angles */
+	FVector GetTangentDirection(float Angle) const;
+
+	/**
+	 * Closest point to the world space point on the pipe's cross-section at the given angle
+	 * @param OutRadial Distance of the returned point from the pipe's axis
+	 */
+	FVector GetClosestPointOnSection(const FVector& Point, float Angle, float& OutRadial) const;
+
+	/** Upper bound on the angle spanned by each convex segment */
+	static constexpr float MaxSegmentRadians = UE_PI / 8.f;
+
+	/** Number of convex segments the arc is split into, for collision against convex shapes */
+	int32 GetNumSegments() const { return FMath::Max(1, FMath::CeilToInt(ArcRadians / MaxSegmentRadians)); }
+
+	/** Directions in the pipe's plane of the start and end of the segment */
+	void GetSegmentDirections(int32 Segment, FVector2D& OutStart, FVector2D& OutEnd) const;
+
+	/**
+	 * Furthest point of a convex segment in the given world space direction
+	 * A segment is the annular sector between its start and end with the inner wall replaced by the chord between
+	 * them, which approximates the inner wall to within InnerRadius * (1 - cos(MaxSegmentRadians / 2)), about 2%
+	 */
+	FVector GetSegmentSupportPoint(const FVector2D& Start, const FVector2D& End, const FVector& Direction) const;
+
+protected:
+	FVector ToLocal(const FVector& Point) const
+	{
+		const FVector Delta = Point - Center;
+		return { Delta | Forward, Delta | Right, Delta | Up };
+	}
+
+	FVector ToWorld(const FVector& Local) const
+	{
+		return Center + Forward * Local.X + Right * Local.Y + Up * Local.Z;
+	}
+
+	static FVector2D GetArcDirection(float Angle)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, Angle);
+		return { Cos, Sin };
+	}
+
+	/** Angle of the local point around the Up axis, from 0 to 2PI */
+	static float GetAngle(const FVector& Local)
+	{
+		const float Angle = FMath::Atan2(Local.Y, Local.X);
+		return Angle < 0.f ? Angle + UE_TWO_PI : Angle;
+	}
+};
+
 /**
  * Represents a Pipe shape in the Tether physics system.
  *
@@ -32,10 +146,25 @@ struct TETHERPHYSICS_API FTetherShape_Pipe : public FTetherShape
 	/** Returns the gameplay tag associated with this shape type */
 	static FGameplayTag StaticShapeType() { return FTetherGameplayTags::Tether_Shape_Pipe; }
 
+	/** Cheaper than FTetherShapeCaster::IsChildOf(), compares the shape type IDs */
+	static bool IsPipe(const FTetherShape& Shape);
+
+	/** Caches the current shape data as the local space data */
+	void CaptureLocalSpace();
+
 	void ToLocalSpace_Implementation();
+
+	/** Local space data, cached when the shape is transformed to world space */
+	FTetherPipeLocalSpace LocalSpace;
+
+	/** Computes the bounds of the shape without allocating */
+	FTetherShapeBounds ComputeBounds() const;
 	
 	/** Calculates the axis-aligned bounding box that encapsulates the pipe */
 	FTetherShape_AxisAlignedBoundingBox GetBoundingBox() const;
+
+	/** World space frame used by the narrow-phase closest-point queries */
+	FTetherPipeGeometry GetGeometry() const { return FTetherPipeGeometry(*this); }
 	
 	/** Center of the pipe */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
@@ -91,6 +220,12 @@ public:
 	/** Gets the shape as a bounding box */
 	virtual FTetherShape_AxisAlignedBoundingBox GetBoundingBox(const FTetherShape& Shape) const override;
 
+	/** Computes the bounds of the shape, cached on the shape by FTetherShape::UpdateBounds() */
+	virtual FTetherShapeBounds ComputeBounds(const FTetherShape& Shape) const override;
+
+	/** Furthest point on the shape in the given direction */
+	virtual FVector GetSupportPoint(const FTetherShape& Shape, const FVector& Direction) const override;
+
 	/** Draws the shape for debugging purposes */
 	virtual void DrawDebug(const FTetherShape& Shape, FAnimInstanceProxy* Proxy, const UWorld* World,
 		const FColor& Color, bool bPersistentLines, float LifeTime, float Thickness) const override;
@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "TetherGameplayTags.h"
 #include "TetherIO.h"
+#include "TetherPhysicsTypes.h"
 #include "Engine/DataAsset.h"
 #include "TetherDataAsset.generated.h"
 
@@ -46,4 +47,15 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(PinHiddenByDefault, ClampMin="1", UIMin="1", UIMax="120"))
 	float SimulationFrameRate = 60.f;
+
+	/**
+	 * Maximum number of simulation sub-ticks per frame, 0 is unlimited
+	 * Prevents a hitch from causing ever longer frames as the simulation tries to catch up
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(ClampMin="0", UIMin="0", UIMax="16"))
+	int32 MaxSubsteps = 4;
+
+	/** What to do with the time that exceeds MaxSubsteps */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(EditCondition="MaxSubsteps>0", EditConditionHides))
+	ETetherSubstepOverflow SubstepOverflow = ETetherSubstepOverflow::Drop;
 };
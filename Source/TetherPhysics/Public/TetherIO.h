@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Shapes/TetherShape.h"
+#include "Physics/Collision/TetherCollisionBatch.h"
+#include "Physics/Collision/TetherPairCache.h"
 #include "TetherIO.generated.h"
 
 /** Damping model used for linear or angular motion. */
@@ -107,12 +109,16 @@ struct TETHERPHYSICS_API FSpatialHashingInput : public FTetherIO
 		: BucketSizeMode(InBucketSizeMode)
 		, BucketSize(50.f)
 		, OriginOffset(FVector::ZeroVector)
+		, DynamicTreeMargin(5.f)
+		, IgnoreMatrix(nullptr)
 	{}
     
 	FSpatialHashingInput(const ETetherBucketSizingStrategy& InBucketSizeMode, const FVector& InBucketSize, const FVector& InOrigin)
 		: BucketSizeMode(InBucketSizeMode)
 		, BucketSize(InBucketSize)
 		, OriginOffset(InOrigin)
+		, DynamicTreeMargin(5.f)
+		, IgnoreMatrix(nullptr)
 	{}
 
 	/** Strategy for sizing buckets in spatial hashing. */
@@ -126,13 +132,265 @@ struct TETHERPHYSICS_API FSpatialHashingInput : public FTetherIO
 	/** Origin of the spatial hash grid */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
 	FVector OriginOffset;
+
+	/**
+	 * Distance to enlarge each shape's bounds by when stored in a dynamic tree
+	 * Shapes are only reinserted into the tree once they move outside of their enlarged bounds
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether, meta=(UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float DynamicTreeMargin;
+
+	/** Optional explicit shape pair exclusions, checked after the collision group filter */
+	const FTetherCollisionIgnoreMatrix* IgnoreMatrix;
+};
+
+/**
+ * Flat spatial hash cell table, built with a counting sort.
+ *
+ * Entries (cell key, shape index) are gathered unsorted, then scattered into contiguous arrays sorted by hash slot,
+ * with SlotStarts holding the offset of each slot. Distinct cells may share a slot, so consumers compare CellKeys
+ * before treating two entries as being in the same cell.
+ *
+ * All arrays are Reset() rather than emptied, so the table reaches a steady state with no per-tick allocation.
+ */
+struct TETHERPHYSICS_API FTetherSpatialHashCellTable
+{
+	/** Cell key of each entry, sorted by hash slot */
+	TArray<FIntVector> CellKeys;
+
+	/** Shape index of each entry, parallel to CellKeys */
+	TArray<int32> ShapeIndices;
+
+	/** Offset into CellKeys/ShapeIndices where each slot begins, with a trailing entry equal to Num() */
+	TArray<int32> SlotStarts;
+
+protected:
+	/** Unsorted entries gathered by Add(), consumed by Build() */
+	TArray<FIntVector> PendingCellKeys;
+	TArray<int32> PendingShapeIndices;
+	TArray<int32> PendingSlots;
+
+public:
+	/** Clear all entries while retaining allocations */
+	void Reset()
+	{
+		CellKeys.Reset();
+		ShapeIndices.Reset();
+		SlotStarts.Reset();
+		PendingCellKeys.Reset();
+		PendingShapeIndices.Reset();
+		PendingSlots.Reset();
+	}
+
+	/** Add a shape to a cell, call Build() once all shapes have been added */
+	void Add(const FIntVector& CellKey, int32 ShapeIndex)
+	{
+		PendingCellKeys.Add(CellKey);
+		PendingShapeIndices.Add(ShapeIndex);
+	}
+
+	/** Counting sort all pending entries by hash slot */
+	void Build()
+	{
+		const int32 NumEntries = PendingCellKeys.Num();
+		const int32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(1, NumEntries * 2));
+		const uint32 SlotMask = static_cast<uint32>(NumSlots - 1);
+
+		// Count entries per slot
+		SlotStarts.Reset();
+		SlotStarts.AddZeroed(NumSlots + 1);
+		PendingSlots.Reset();
+		PendingSlots.AddUninitialized(NumEntries);
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			const int32 Slot = static_cast<int32>(HashCellKey(PendingCellKeys[i]) & SlotMask);
+			PendingSlots[i] = Slot;
+			SlotStarts[Slot]++;
+		}
+
+		// Inclusive prefix sum, each slot now holds its end offset
+		for (int32 Slot = 1; Slot < NumSlots; Slot++)
+		{
+			SlotStarts[Slot] += SlotStarts[Slot - 1];
+		}
+		SlotStarts[NumSlots] = NumEntries;
+
+		// Scatter in reverse, decrementing each slot back to its start offset, which keeps the sort stable
+		CellKeys.Reset();
+		CellKeys.AddUninitialized(NumEntries);
+		ShapeIndices.Reset();
+		ShapeIndices.AddUninitialized(NumEntries);
+		for (int32 i = NumEntries - 1; i >= 0; i--)
+		{
+			const int32 Index = --SlotStarts[PendingSlots[i]];
+			CellKeys[Index] = PendingCellKeys[i];
+			ShapeIndices[Index] = PendingShapeIndices[i];
+		}
+	}
+
+	int32 Num() const { return CellKeys.Num(); }
+	int32 NumSlots() const { return FMath::Max(0, SlotStarts.Num() - 1); }
+
+	/** Calls Func(const FIntVector& CellKey) once for every occupied cell */
+	template<typename FuncType>
+	void ForEachOccupiedCell(FuncType&& Func) const
+	{
+		for (int32 Slot = 0; Slot < NumSlots(); Slot++)
+		{
+			const int32 Start = SlotStarts[Slot];
+			const int32 End = SlotStarts[Slot + 1];
+			for (int32 i = Start; i < End; i++)
+			{
+				// Skip cells already visited within this slot
+				bool bVisited = false;
+				for (int32 j = Start; j < i && !bVisited; j++)
+				{
+					bVisited = CellKeys[j] == CellKeys[i];
+				}
+				if (!bVisited)
+				{
+					Func(CellKeys[i]);
+				}
+			}
+		}
+	}
+
+	/** Spatial hash of a cell key, using the large primes popularized by Teschner et al. */
+	static uint32 HashCellKey(const FIntVector& CellKey)
+	{
+		return (static_cast<uint32>(CellKey.X) * 73856093u) ^ (static_cast<uint32>(CellKey.Y) * 19349663u) ^
+			(static_cast<uint32>(CellKey.Z) * 83492791u);
+	}
+};
+
+/**
+ * Endpoint of a shape's bounds along a single axis, used by sweep and prune
+ */
+struct TETHERPHYSICS_API FTetherSweepAndPruneEndpoint
+{
+	FTetherSweepAndPruneEndpoint(double InValue = 0.0, int32 InShapeIndex = INDEX_NONE, bool bInMax = false)
+		: Value(InValue)
+		, ShapeIndex(InShapeIndex)
+		, bMax(bInMax)
+	{}
+
+	/** Position of the endpoint along the axis, double so large world coordinates aren't truncated */
+	double Value;
+
+	/** Index of the shape this endpoint belongs to */
+	int32 ShapeIndex;
+
+	/** Whether this is the max endpoint, otherwise the min endpoint */
+	bool bMax;
+
+	/** Sort by value, with min endpoints first so touching bounds are considered overlapping */
+	bool operator<(const FTetherSweepAndPruneEndpoint& Other) const
+	{
+		return Value < Other.Value || (Value == Other.Value && !bMax && Other.bMax);
+	}
+};
+
+/**
+ * Persistent sweep and prune state, retained between ticks so the endpoint lists stay nearly sorted
+ */
+struct TETHERPHYSICS_API FTetherSweepAndPruneData
+{
+	/** Sorted min/max endpoints of every shape along SweepAxis, the other axes are never swept so aren't kept */
+	TArray<FTetherSweepAndPruneEndpoint> Endpoints;
+
+	/** World space bounds of every shape, updated each tick */
+	TArray<FBox> ShapeBounds;
+
+	/** Shapes the endpoints were built from, a change here requires the endpoints to be rebuilt */
+	TArray<const FTetherShape*> Shapes;
+
+	/** Shapes whose interval is open during the sweep */
+	TArray<int32> ActiveShapes;
+
+	/** The axis that was swept on the last tick, Endpoints are sorted along it */
+	int32 SweepAxis = 0;
+
+	void Reset()
+	{
+		Endpoints.Reset();
+		ShapeBounds.Reset();
+		Shapes.Reset();
+		ActiveShapes.Reset();
+		SweepAxis = 0;
+	}
+};
+
+/**
+ * Node of a dynamic bounding volume hierarchy
+ * Leaves reference a shape, internal nodes always have two children
+ */
+struct TETHERPHYSICS_API FTetherDynamicTreeNode
+{
+	/** Enlarged bounds for leaves, union of the children's bounds for internal nodes */
+	FBox Bounds = FBox(ForceInit);
+
+	/** Parent node, or the next free node when this node is in the free list */
+	int32 Parent = INDEX_NONE;
+
+	int32 Child1 = INDEX_NONE;
+	int32 Child2 = INDEX_NONE;
+
+	/** Index of the shape referenced by a leaf */
+	int32 ShapeIndex = INDEX_NONE;
+
+	/** Leaves have a height of 0, free nodes -1 */
+	int32 Height = 0;
+
+	bool IsLeaf() const { return Child1 == INDEX_NONE; }
+};
+
+/**
+ * Persistent dynamic bounding volume hierarchy, retained between ticks so shapes are only reinserted when they leave
+ * their enlarged bounds
+ */
+struct TETHERPHYSICS_API FTetherDynamicTreeData
+{
+	/** All nodes in the tree, including free nodes */
+	TArray<FTetherDynamicTreeNode> Nodes;
+
+	int32 Root = INDEX_NONE;
+
+	/** Head of the linked list of free nodes */
+	int32 FreeList = INDEX_NONE;
+
+	/** Leaf node of every shape */
+	TArray<int32> ShapeLeaves;
+
+	/** Tight world space bounds of every shape, updated each tick */
+	TArray<FBox> ShapeBounds;
+
+	/** Shapes the tree was built from, a change here requires the tree to be rebuilt */
+	TArray<const FTetherShape*> Shapes;
+
+	/** Scratch stack for traversing the tree */
+	TArray<int32> QueryStack;
+
+	/** Number of leaves reinserted on the last tick */
+	int32 NumReinserted = 0;
+
+	void Reset()
+	{
+		Nodes.Reset();
+		Root = INDEX_NONE;
+		FreeList = INDEX_NONE;
+		ShapeLeaves.Reset();
+		ShapeBounds.Reset();
+		Shapes.Reset();
+		QueryStack.Reset();
+		NumReinserted = 0;
+	}
 };
 
 /**
  * Output data produced by spatial hashing.
  *
  * This struct stores the results of spatial hashing, including the pairs of shapes
- * that should be tested for collisions and the spatial hash map itself.
+ * that should be tested for collisions and the spatial hash cell table itself.
  */
 USTRUCT(BlueprintType)
 struct TETHERPHYSICS_API FSpatialHashingOutput : public FTetherIO
@@ -149,8 +407,20 @@ struct TETHERPHYSICS_API FSpatialHashingOutput : public FTetherIO
 	/** Pairs of shapes that should be tested for collisions */
 	TArray<FTetherShapePair> ShapePairs;
 
-	/** Spatial hash map storing shape indices by grid cell */
-	TMap<FIntVector, TArray<int32>> SpatialHashMap;
+	/** Spatial hash cell table storing shape indices by grid cell */
+	FTetherSpatialHashCellTable SpatialHashCells;
+
+	/** Persistent sweep and prune endpoints, used by UTetherHashingSweepAndPrune */
+	FTetherSweepAndPruneData SweepAndPrune;
+
+	/** Persistent bounding volume hierarchy, used by UTetherHashingDynamicTree */
+	FTetherDynamicTreeData DynamicTree;
+
+	/**
+	 * Keys of the shape pairs that have already been emitted this tick
+	 * Shapes are inserted into every cell their bounds overlap, so the same pair can be found in multiple cells
+	 */
+	TSet<uint64> ShapePairKeys;
 };
 
 /**
@@ -551,8 +821,12 @@ struct TETHERPHYSICS_API FNarrowPhaseInput : public FTetherIO
 	/** Pairings detected during Broad-Phase collision */
 	const TArray<FTetherShapePair>* CollisionPairings;
 
-	TMap<const FTetherShape*, const FLinearOutput*> LinearOutputs;
-	TMap<const FTetherShape*, const FAngularOutput*> AngularOutputs;
+	/** Persistent pair cache owned by the Broad-Phase output, receives narrow-phase contact states if provided */
+	FTetherPairCache* PairCache = nullptr;
+
+	/** Solver outputs for each shape, indexed by FTetherShape::SimulationIndex */
+	TArray<const FLinearOutput*> LinearOutputs;
+	TArray<const FAngularOutput*> AngularOutputs;
 };
 
 /**
@@ -619,6 +893,9 @@ struct TETHERPHYSICS_API FNarrowPhaseOutput : public FTetherIO
 	{}
 
 	TArray<FNarrowPhaseCollision> Collisions;
+
+	/** Scratch for the batched sphere and capsule kernels, kept here so allocations persist between ticks */
+	FTetherNarrowPhaseBatches Batches;
 };
 
 /**
@@ -662,6 +939,9 @@ struct TETHERPHYSICS_API FBroadPhaseOutput : public FTetherIO
 	/** Array of collision pairs detected in the broad-phase */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
 	TArray<FTetherShapePair> CollisionPairings;
+
+	/** Persistent per-pair data and contact states, retained between ticks */
+	FTetherPairCache PairCache;
 };
 
 /**
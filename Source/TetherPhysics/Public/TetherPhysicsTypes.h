@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "TetherGameplayTags.h"
 #include "TetherIO.h"
+#include "Physics/Solvers/TetherBodyStore.h"
+#include "Physics/Solvers/TetherIslands.h"
 #include "TetherPhysicsTypes.generated.h"
 
 class UTetherContactSolver;
@@ -18,6 +20,17 @@ class UTetherPhysicsSolverAngular;
 class UTetherPhysicsSolverLinear;
 class UTetherActivityStateHandler;
 
+/**
+ * How a frame is handled when it needs more sub-ticks than the simulation's maximum substeps allow
+ */
+UENUM(BlueprintType)
+enum class ETetherSubstepOverflow : uint8
+{
+	Drop				UMETA(ToolTip="Discard the time that could not be simulated, the simulation falls behind real time"),
+	SlowMotion			UMETA(ToolTip="Carry the time over to following frames, the simulation slows down during a hitch and then catches up"),
+	VariableStep		UMETA(ToolTip="Simulate the remaining time as one final, longer sub-tick"),
+};
+
 /**
  * Convenience struct for handling detection and changing of common global solver types
  */
@@ -140,10 +153,21 @@ struct TETHERPHYSICS_API FTetherCommonSharedData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tether)
 	FSpatialHashingOutput SpatialHashingOutput;
 
+	/** Structure-of-arrays state of every body, solved in batches by the solvers' SolveAll() */
+	FTetherBodyStore Bodies;
+
+	/** Bodies connected by contacts, rebuilt after each narrow-phase */
+	FTetherIslands Islands;
+
+	/** Explicit shape pair exclusions, rebuilt before hashing whenever they or the shapes change */
+	FTetherCollisionIgnoreMatrix IgnoreMatrix;
+
 	void InitializeSharedData()
 	{
+		SpatialHashingInput.IgnoreMatrix = &IgnoreMatrix;
 		BroadPhaseInput.PotentialCollisionPairings = &SpatialHashingOutput.ShapePairs;
 		NarrowPhaseInput.CollisionPairings = &BroadPhaseOutput.CollisionPairings;
+		NarrowPhaseInput.PairCache = &BroadPhaseOutput.PairCache;
 	}
 };
 